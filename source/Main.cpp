@@ -32,8 +32,12 @@
 #include "network/Server.hpp"
 #include "utils/Types.hpp"
 #include "network/ServerDiscovery.hpp"
+#include "game/Room.hpp"
+#include "game/TileMap.hpp"
 #include "utils/Args.hpp"
 #include <iostream>
+#include <fstream>
+#include <iterator>
 #include <thread>
 #include <signal.h>
 #include <atomic>
@@ -73,10 +77,31 @@ int main(int argc, char *argv[])
         }
     });
 
+    std::string roomPath;
+
+    tkd::Args::addHandler("--room",
+    [&roomPath](const std::string& value)
+    {
+        roomPath = value;
+    });
+
     tkd::Args::handleArgs(argc, argv);
 
     try {
-        tkd::Server server(port);
+        tkd::Room room;
+
+        if (!roomPath.empty()) {
+            std::ifstream file(roomPath, std::ios::binary);
+            if (!file)
+                throw std::runtime_error("Cannot open room: " + roomPath);
+            tkd::UData data(
+                (std::istreambuf_iterator<char>(file)),
+                std::istreambuf_iterator<char>()
+            );
+            room = tkd::Room(tkd::TileMap::load(data));
+        }
+
+        tkd::Server server(port, room);
 
         tkd::ServerDiscovery discovery(port);
         discovery.startBroadcasting();
@@ -113,9 +138,11 @@ int main(int argc, char *argv[])
 ///////////////////////////////////////////////////////////////////////////////
 #include "utils/Types.hpp"
 #include "resources/AssetsPacker.hpp"
+#include "game/TileMap.hpp"
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <fstream>
 #include <unistd.h>
 
 int main(void)
@@ -158,19 +185,149 @@ int main(void)
                     std::cout << "Error: " << error.what() << std::endl;
                 }
             } else std::cout << "Usage: add <filename> <key>" << std::endl;
+        } else if (token == "add-dir" || token == "ad") {
+            std::string directory;
+            size_t threads = 0;
+            if (iss >> directory) {
+                iss >> threads;
+                try {
+                    packer.addDirectory(directory, threads);
+                } catch (const std::exception& error) {
+                    std::cout << "Error: " << error.what() << std::endl;
+                }
+            } else std::cout << "Usage: add-dir <directory> [threads]"
+                             << std::endl;
+        } else if (token == "update" || token == "up") {
+            std::string directory;
+            size_t threads = 0;
+            if (iss >> directory) {
+                iss >> threads;
+                try {
+                    auto update = packer.updateDirectory(directory, threads);
+                    std::cout << "Recompressed " << update.recompressed
+                              << " file(s), removed " << update.removed
+                              << " key(s)" << std::endl;
+                } catch (const std::exception& error) {
+                    std::cout << "Error: " << error.what() << std::endl;
+                }
+            } else std::cout << "Usage: update <directory> [threads]"
+                             << std::endl;
         } else if (token == "display" || token == "d") {
             std::cout << packer;
         } else if (token == "clear") {
             packer.clear();
+        } else if (token == "codec") {
+            std::string name;
+            tkd::AssetsPacker::Encoding encoding = packer.getEncoding();
+            if (!(iss >> name)) {
+                std::cout << "Usage: codec <stored|zlib|lz4|zstd> [level]"
+                          << std::endl
+                          << "       codec auto [budget in ms per Mo]"
+                          << std::endl;
+            } else if (name == "auto") {
+                encoding.automatic = true;
+                if (!(iss >> encoding.budget))
+                    encoding.budget = tkd::Compressor::DEFAULT_DECODE_BUDGET;
+                packer.setEncoding(encoding);
+            } else if (auto codec = tkd::Compressor::fromName(name)) {
+                encoding.automatic = false;
+                encoding.codec = *codec;
+                if (!(iss >> encoding.level))
+                    encoding.level = tkd::Compressor::defaultLevel(*codec);
+                packer.setEncoding(encoding);
+            } else std::cout << "Unknown codec: " << name << std::endl;
+        } else if (token == "images") {
+            std::string mode;
+            tkd::AssetsPacker::Encoding encoding = packer.getEncoding();
+            if (iss >> mode && (mode == "raw" || mode == "source")) {
+                encoding.rawImages = mode == "raw";
+                packer.setEncoding(encoding);
+            } else std::cout << "Usage: images <raw|source>" << std::endl;
+        } else if (token == "train" || token == "t") {
+            size_t capacity = tkd::Compressor::DEFAULT_DICTIONARY_SIZE;
+            iss >> capacity;
+            try {
+                packer.trainDictionaries(capacity);
+            } catch (const std::exception& error) {
+                std::cout << "Error: " << error.what() << std::endl;
+            }
+        } else if (token == "atlas") {
+            tkd::Uint32 size = tkd::AssetsPacker::DEFAULT_ATLAS_SIZE;
+            tkd::Uint32 padding = 1;
+            iss >> size >> padding;
+            try {
+                packer.bakeAtlases(size, padding);
+            } catch (const std::exception& error) {
+                std::cout << "Error: " << error.what() << std::endl;
+            }
+        } else if (token == "cache" || token == "c") {
+            size_t budget;
+            if (iss >> budget)
+                packer.setCacheBudget(budget);
+            tkd::AssetsCache::Stats stats = packer.getCacheStats();
+            std::cout << "Hits: " << stats.hits
+                      << ", Misses: " << stats.misses
+                      << ", Evictions: " << stats.evictions << std::endl
+                      << "Usage: " << stats.count << " assets, "
+                      << tkd::AssetsPacker::formatSize(stats.size) << " / "
+                      << tkd::AssetsPacker::formatSize(stats.budget)
+                      << std::endl;
+        } else if (token == "room") {
+            std::string source, target;
+            if (iss >> source >> target) {
+                try {
+                    std::ifstream file(source);
+                    if (!file)
+                        throw std::runtime_error("Cannot open: " + source);
+                    std::stringstream text;
+                    text << file.rdbuf();
+                    tkd::UData data = tkd::TileMap::parse(text.str()).save();
+                    std::ofstream out(target, std::ios::binary);
+                    out.write(
+                        reinterpret_cast<const char*>(data.data()),
+                        data.size()
+                    );
+                    if (!out)
+                        throw std::runtime_error("Cannot write: " + target);
+                } catch (const std::exception& error) {
+                    std::cout << "Error: " << error.what() << std::endl;
+                }
+            } else std::cout << "Usage: room <layout.txt> <file.map>"
+                << std::endl;
+        } else if (token == "verify" || token == "v") {
+            std::string filename;
+            try {
+                if (iss >> filename)
+                    packer.unpack(filename);
+                std::vector<std::string> corrupted = packer.verify();
+                for (const std::string& key : corrupted)
+                    std::cout << "Corrupted: " << key << std::endl;
+                if (corrupted.empty())
+                    std::cout << "All blobs verified" << std::endl;
+            } catch (const std::exception& error) {
+                std::cout << "Error: " << error.what() << std::endl;
+            }
         } else if (token == "extract" || token == "e") {
-            std::string key;
+            std::string key, filename;
             if (iss >> key) {
-                std::optional<tkd::AssetsPacker::ImagePtr> image =
-                    packer.getImage(key);
-                if (!image)
-                    std::cout << "Cannot find: " << key << std::endl;
-                else image->get()->saveToFile(key);
-            } else std::cout << "Usage: extract <key>" << std::endl;
+                if (!(iss >> filename))
+                    filename = key;
+                try { packer.extract(key, filename); }
+                catch (const std::exception& error) {
+                    std::cout << "Error: " << error.what() << std::endl;
+                }
+            } else std::cout << "Usage: extract <key> [file]" << std::endl;
+        } else if (token == "extract-all" || token == "ea") {
+            std::string directory;
+            if (iss >> directory) {
+                try {
+                    size_t count = packer.extractAll(directory);
+                    std::cout << "Extracted " << count << " asset(s)"
+                        << std::endl;
+                } catch (const std::exception& error) {
+                    std::cout << "Error: " << error.what() << std::endl;
+                }
+            } else std::cout << "Usage: extract-all <directory>" << std::endl;
         } else if (token == "quit" || token == "q") {
             break;
         } else {
@@ -181,6 +338,104 @@ int main(void)
     return (EXIT_SUCCESS);
 }
 
+#elif defined(NEON_BENCHMARK)
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "resources/AssetsBenchmark.hpp"
+#include "physics/ColliderBenchmark.hpp"
+#include "utils/Args.hpp"
+#include <string>
+#include <iostream>
+#include <filesystem>
+
+///////////////////////////////////////////////////////////////////////////////
+// Commit the benchmark is built from, set by the Makefile
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEON_BUILD_ID
+    #define NEON_BUILD_ID ""
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+    std::string output = "benchmark.json";
+    std::string build = NEON_BUILD_ID;
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "neon-benchmark";
+    size_t scale = 1;
+    int iterations = 3;
+    std::string suite = "all";
+
+    tkd::Args::addHandler("--suite",
+    [&suite](const std::string& value)
+    {
+        suite = value;
+    }, "Run only one suite: assets or collider");
+
+    tkd::Args::addHandler("--output",
+    [&output](const std::string& value)
+    {
+        output = value;
+    }, "Write the results as JSON to this file");
+
+    tkd::Args::addHandler("--directory",
+    [&directory](const std::string& value)
+    {
+        directory = value;
+    }, "Generate the corpus and the packs in this directory");
+
+    tkd::Args::addHandler("--scale",
+    [&scale](const std::string& value)
+    {
+        try {
+            scale = std::stoul(value);
+        } catch (const std::exception& e) {
+            std::cerr << "Unable to process scale: " << e.what() << std::endl;
+        }
+    }, "Multiply the number of files in the corpus");
+
+    tkd::Args::addHandler("--iterations",
+    [&iterations](const std::string& value)
+    {
+        try {
+            iterations = std::stoi(value);
+        } catch (const std::exception& e) {
+            std::cerr << "Unable to process iterations: " << e.what()
+                << std::endl;
+        }
+    }, "Number of runs, the fastest one is reported");
+
+    tkd::Args::handleArgs(argc, argv);
+
+    if (suite != "all" && suite != "assets" && suite != "collider") {
+        std::cerr << "Unknown suite: " << suite << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    try {
+        if (suite != "collider") {
+            tkd::AssetsBenchmark benchmark(directory, scale, iterations);
+            auto results = benchmark.run();
+            tkd::AssetsBenchmark::print(std::cout, results);
+            tkd::AssetsBenchmark::save(
+                output, build.empty() ? "unknown" : build, results
+            );
+            std::cout << "Results saved to " << output << std::endl;
+        }
+        if (suite != "assets") {
+            tkd::ColliderBenchmark benchmark(iterations);
+            tkd::ColliderBenchmark::print(std::cout, benchmark.run());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+    return (EXIT_SUCCESS);
+}
+
 #else
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -195,6 +450,7 @@ int main(void)
 int main(int argc, char *argv[])
 {
     bool debug = false;
+    std::string assets;
 
     tkd::Args::addHandler("--debug",
     [&debug](const std::string& value)
@@ -203,10 +459,16 @@ int main(int argc, char *argv[])
         debug = true;
     }, "Start the game in debug mode");
 
+    tkd::Args::addHandler("--assets",
+    [&assets](const std::string& value)
+    {
+        assets = value;
+    }, "Load the game assets from a pack file");
+
     tkd::Args::handleArgs(argc, argv);
 
     {
-        tkd::Engine engine(debug);
+        tkd::Engine engine(debug, assets);
         engine.start();
     }
 
@@ -31,6 +31,9 @@
 #include "states/MenuState.hpp"
 #include "imgui/imgui.h"
 #include "imgui/imgui-SFML.h"
+#include <iostream>
+#include <algorithm>
+#include <thread>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -39,11 +42,40 @@ namespace tkd
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Engine::Engine(bool debug)
+// The cores left once the main thread has its own
+///////////////////////////////////////////////////////////////////////////////
+static const size_t WORKER_THREADS =
+    std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+///////////////////////////////////////////////////////////////////////////////
+// The loader only decodes in bursts, so it gets a quarter of the workers and
+// the update jobs the rest, both pools together fitting the cores
+///////////////////////////////////////////////////////////////////////////////
+static const size_t LOADER_THREADS = std::max<size_t>(1, WORKER_THREADS / 4);
+static const size_t JOB_THREADS =
+    std::max<size_t>(1, WORKER_THREADS - LOADER_THREADS);
+
+///////////////////////////////////////////////////////////////////////////////
+Engine::Engine(bool debug, const std::string& assets)
     : m_window(sf::VideoMode(800, 600), "MyNeonAbyss", sf::Style::Close)
     , m_debug(debug)
-    , m_manager(m_window, &m_client, &m_debug)
+    , m_loader(m_assets, LOADER_THREADS)
+    , m_jobs(JOB_THREADS)
+    , m_manager(m_window, &m_client, &m_debug, &m_loader, &m_jobs)
 {
+    if (!assets.empty()) {
+        // Debug runs check the whole pack up front, release runs only check
+        // each blob the first time it is decoded
+        m_assets.setVerification(debug
+            ? AssetsPacker::Verification::Eager
+            : AssetsPacker::Verification::FirstUse
+        );
+        try {
+            m_assets.unpack(assets);
+        } catch (const std::exception& error) {
+            std::cerr << "Cannot load assets: " << error.what() << std::endl;
+        }
+    }
     m_manager.push(std::make_unique<States::Menu>());
 }
 
@@ -79,7 +111,6 @@ void Engine::start(void)
     tkd::Packet packet;
     sf::Clock clock;
     sf::Time restart;
-    float deltaT;
 
     if (!ImGui::SFML::Init(m_window))
         exit(84);
@@ -89,8 +120,6 @@ void Engine::start(void)
     while (m_window.isOpen()) {
         restart = clock.restart();
 
-        deltaT = restart.asSeconds();
-
         if (m_debug)
             ImGui::SFML::Update(m_window, restart);
 
@@ -109,12 +138,17 @@ void Engine::start(void)
         while (m_client.receivePacket(packet))
             m_manager.handlePacket(packet);
 
-        m_manager.update(deltaT);
+        // The simulation runs at a fixed rate, the frame only decides how
+        // many steps are due
+        Uint32 steps = m_timestep.advance(restart.asSeconds());
+        for (Uint32 i = 0; i < steps; i++)
+            m_manager.update(m_timestep.getStep());
+        m_loader.update();
 
         renderFpsDisplay();
 
         m_window.clear();
-        m_manager.render();
+        m_manager.render(m_timestep.getAlpha());
         if (m_debug)
             ImGui::SFML::Render(m_window);
         m_window.display();
@@ -34,6 +34,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "states/StateManager.hpp"
 #include "network/Client.hpp"
+#include "resources/AssetsPacker.hpp"
+#include "resources/AssetsLoader.hpp"
+#include "utils/FixedTimestep.hpp"
+#include "utils/JobSystem.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 
@@ -56,7 +60,11 @@ private:
     sf::RenderWindow m_window;      //<! The rendering window
     Client m_client;                //<! The engine network client
     bool m_debug;                   //<! Is the debug mode activated
+    AssetsPacker m_assets;          //<! The unpacked game assets
+    AssetsLoader m_loader;          //<! The background assets loader
+    JobSystem m_jobs;               //<! The workers of the update jobs
     StateManager m_manager;         //<! The state manager
+    FixedTimestep m_timestep;       //<! The simulation step accumulator
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -70,9 +78,10 @@ public:
     /// \brief Default engine constructor
     ///
     /// \param debug Put the engine in debug mode
+    /// \param assets The assets pack to load, if any
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Engine(bool debug = false);
+    Engine(bool debug = false, const std::string& assets = "");
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "core/SpriteBatch.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(void)
+    : m_used(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::clear(void)
+{
+    for (size_t i = 0; i < m_used; i++)
+        m_batches[i].vertices.clear();
+    m_used = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::add(
+    const sf::Texture& texture,
+    const sf::IntRect& rect,
+    const sf::Transform& transform,
+    const sf::Color& color
+)
+{
+    // A new run starts whenever the texture changes
+    if (m_used == 0 || m_batches[m_used - 1].texture != &texture) {
+        if (m_used == m_batches.size())
+            m_batches.push_back({nullptr, sf::VertexArray(sf::Triangles)});
+        m_batches[m_used].texture = &texture;
+        m_batches[m_used].vertices.clear();
+        m_used++;
+    }
+
+    float width = static_cast<float>(rect.width);
+    float height = static_cast<float>(rect.height);
+    float left = static_cast<float>(rect.left);
+    float top = static_cast<float>(rect.top);
+
+    sf::Vertex corners[4] = {
+        {transform.transformPoint(0, 0), color, {left, top}},
+        {transform.transformPoint(width, 0), color, {left + width, top}},
+        {transform.transformPoint(0, height), color, {left, top + height}},
+        {
+            transform.transformPoint(width, height),
+            color,
+            {left + width, top + height}
+        }
+    };
+
+    sf::VertexArray& vertices = m_batches[m_used - 1].vertices;
+    vertices.append(corners[0]);
+    vertices.append(corners[1]);
+    vertices.append(corners[2]);
+    vertices.append(corners[2]);
+    vertices.append(corners[1]);
+    vertices.append(corners[3]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::add(const sf::Sprite& sprite)
+{
+    if (sprite.getTexture() == nullptr)
+        return;
+    add(
+        *sprite.getTexture(),
+        sprite.getTextureRect(),
+        sprite.getTransform(),
+        sprite.getColor()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t SpriteBatch::getDrawCalls(void) const
+{
+    return (m_used);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::render(sf::RenderTarget& target) const
+{
+    for (size_t i = 0; i < m_used; i++) {
+        sf::RenderStates states(m_batches[i].texture);
+        target.draw(m_batches[i].vertices, states);
+    }
+}
+
+} // namespace tkd
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Collect textured quads and draw them with one call per texture run
+///
+/// Sprites are drawn in the order they were added. Consecutive sprites
+/// sharing a texture, such as sprites cut out of the same atlas page, are
+/// merged in a single vertex array.
+///
+///////////////////////////////////////////////////////////////////////////////
+class SpriteBatch
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run of quads sharing the same texture
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        const sf::Texture* texture;         //<! The texture of the quads
+        sf::VertexArray vertices;           //<! Two triangles per quad
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Batch> m_batches;           //<! The batches, kept allocated
+    size_t m_used;                          //<! The batches of this frame
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create an empty batch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteBatch(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every quad, keeping the memory for the next frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a textured quad
+    ///
+    /// \param texture The texture, which must outlive the next render
+    /// \param rect The area of the texture to draw
+    /// \param transform The transform of the quad
+    /// \param color The color multiplied with the texture
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void add(
+        const sf::Texture& texture,
+        const sf::IntRect& rect,
+        const sf::Transform& transform,
+        const sf::Color& color = sf::Color::White
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a sprite, ignored if it has no texture
+    ///
+    /// \param sprite The sprite to add
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void add(const sf::Sprite& sprite);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of draw calls the next render will issue
+    ///
+    /// \return The number of texture runs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getDrawCalls(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw every quad
+    ///
+    /// \param target The target to draw on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void render(sf::RenderTarget& target) const;
+};
+
+} // namespace tkd
@@ -38,31 +38,43 @@ namespace tkd
 ///////////////////////////////////////////////////////////////////////////////
 Entity::Entity(const Vec2f& position)
     : m_position(position)
+    , m_previous(position)
     , m_onAir(false)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
 void Entity::updatePhysics(float deltaT, const Room& room)
 {
-    static const float GRAVITY = 981.f;
-    static const float FRICTION = .001f;
-
+    m_previous = m_position;
     applyForce(Vec2f(0.f, GRAVITY), deltaT);
 
     float frictionFactor = std::pow(FRICTION, deltaT);
     m_velocity.x *= frictionFactor;
 
-    m_position += m_velocity * deltaT;
+    m_onAir = true;
+    if (!m_collider) {
+        m_position += m_velocity * deltaT;
+        return;
+    }
 
-    if (m_collider)
-        m_collider->setPosition(m_position);
+    // Swept against the room, so no delta is large enough to skip a wall
+    m_collider->setPosition(m_position);
+    Vec2f contact = room.slide(*m_collider, m_velocity * deltaT);
+    m_position = m_collider->getPosition();
+
+    if (contact.x != 0.f)
+        m_velocity.x = 0.f;
+    if (contact.y != 0.f) {
+        m_velocity.y = 0.f;
+        if (contact.y < 0.f)
+            m_onAir = false;
+    }
     handleCollision(room);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Entity::handleCollision(const Room& room)
 {
-    m_onAir = true;
     if (!m_collider || !room.checkCollision(*m_collider))
         return;
 
@@ -83,8 +95,6 @@ void Entity::handleCollision(const Room& room)
 ///////////////////////////////////////////////////////////////////////////////
 void Entity::applyForce(const Vec2f& force, float deltaT)
 {
-    static const float MAX_VELOCITY = 500.f;
-
     m_velocity += force * deltaT;
 
     m_velocity.x = std::clamp(m_velocity.x, -MAX_VELOCITY, MAX_VELOCITY);
@@ -101,6 +111,9 @@ bool Entity::onGround(void) const
 void Entity::setPosition(const Vec2f& position)
 {
     m_position = position;
+    m_previous = position;
+    if (m_collider)
+        m_collider->setPosition(position);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -109,6 +122,12 @@ Vec2f Entity::getPosition(void) const
     return (m_position);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Vec2f Entity::getInterpolatedPosition(float alpha) const
+{
+    return (m_previous + (m_position - m_previous) * alpha);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Vec2f Entity::getVelocity(void) const
 {
@@ -121,4 +140,10 @@ void Entity::setVelocity(const Vec2f& velocity)
     m_velocity = velocity;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+const Collider* Entity::getCollider(void) const
+{
+    return (m_collider.get());
+}
+
 } // namespace tkd
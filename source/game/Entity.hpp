@@ -35,7 +35,6 @@
 #include "utils/Vec2.hpp"
 #include "physics/Collider.hpp"
 #include "game/Room.hpp"
-#include <SFML/Graphics.hpp>
 #include <memory>
 #include <string>
 
@@ -52,11 +51,28 @@ namespace tkd
 ///////////////////////////////////////////////////////////////////////////////
 class Entity
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Physics constants, shared with the EntityStore bodies
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float GRAVITY = 981.f;
+    static constexpr float FRICTION = .001f;
+    static constexpr float MAX_VELOCITY = 500.f;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Player body, shared by the client players and the server bodies
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float PLAYER_WIDTH = 10.f;
+    static constexpr float PLAYER_HEIGHT = 20.f;
+    static constexpr float PLAYER_SPAWN_X = 400.f;
+    static constexpr float PLAYER_SPAWN_Y = 50.f;
+
 protected:
     ///////////////////////////////////////////////////////////////////////////
     // Protected properties
     ///////////////////////////////////////////////////////////////////////////
     Vec2f m_position;                       //<! The entity position
+    Vec2f m_previous;                       //<! The position before the step
     Vec2f m_velocity;                       //<! The entity velocity
     std::unique_ptr<Collider> m_collider;   //<! The entity collider
     bool m_active;                          //<! Is the entity active
@@ -80,7 +96,7 @@ public:
 
 private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Handle collision with the room
+    /// \brief Push the entity out of the room when it overlaps it
     ///
     /// \param room The room reference to check collision with
     ///
@@ -104,14 +120,6 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void handleCollision(Entity* other) = 0;
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief Render the entity
-    ///
-    /// \param window The window to render the entity on
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    virtual void render(sf::RenderWindow& window) = 0;
-
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the entity physics base and resolve the collision with
     /// the room
@@ -142,6 +150,8 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Set the entity position
     ///
+    /// The entity is moved without interpolation from its last position.
+    ///
     /// \param position The new position
     ///
     ///////////////////////////////////////////////////////////////////////////
@@ -155,6 +165,16 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Vec2f getPosition(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the entity position between the two last steps
+    ///
+    /// \param alpha The time since the last step, as a fraction of a step
+    ///
+    /// \return The blended position, for rendering
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f getInterpolatedPosition(float alpha) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Set the entity velocity
     ///
@@ -170,6 +190,14 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Vec2f getVelocity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the entity collider
+    ///
+    /// \return The collider of the entity, nullptr if it has none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Collider* getCollider(void) const;
 };
 
 } // namespace tkd
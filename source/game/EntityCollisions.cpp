@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "game/EntityCollisions.hpp"
+#include "game/Entity.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityCollisions::add(Entity* entity)
+{
+    if (!entity || !entity->getCollider() || m_ids.count(entity))
+        return;
+
+    Uint32 id = m_hash.insert(*entity->getCollider());
+    if (id >= m_entities.size())
+        m_entities.resize(id + 1, nullptr);
+    m_entities[id] = entity;
+    m_ids[entity] = id;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityCollisions::remove(const Entity* entity)
+{
+    auto it = m_ids.find(entity);
+    if (it == m_ids.end())
+        return;
+
+    m_hash.remove(it->second);
+    m_entities[it->second] = nullptr;
+    m_ids.erase(it);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityCollisions::clear(void)
+{
+    m_hash.clear();
+    m_entities.clear();
+    m_ids.clear();
+    m_pairs.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityCollisions::update(void)
+{
+    for (const auto& [entity, id] : m_ids)
+        m_hash.update(id, *entity->getCollider());
+
+    m_hash.findPairs(m_pairs);
+
+    // Callbacks may move the entities, the pairs are the ones of this tick
+    for (const auto& [first, second] : m_pairs) {
+        Entity* a = m_entities[first];
+        Entity* b = m_entities[second];
+        a->handleCollision(b);
+        b->handleCollision(a);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::vector<SpatialHash::Pair>& EntityCollisions::getPairs(void) const
+{
+    return (m_pairs);
+}
+
+} // namespace tkd
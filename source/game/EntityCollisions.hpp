@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "physics/SpatialHash.hpp"
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Pre-define the Entity class
+///////////////////////////////////////////////////////////////////////////////
+class Entity;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Finds the entities colliding with each other every tick
+///
+/// The registered entities are kept in a spatial hash updated from their
+/// colliders. Each overlapping pair is reported to both entities through
+/// Entity::handleCollision. Entities are not owned and must be removed
+/// before they are destroyed.
+///
+///////////////////////////////////////////////////////////////////////////////
+class EntityCollisions
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    SpatialHash m_hash;                                 //<! The broadphase
+    std::vector<Entity*> m_entities;                    //<! Entities by id
+    std::unordered_map<const Entity*, Uint32> m_ids;    //<! Ids by entity
+    std::vector<SpatialHash::Pair> m_pairs;             //<! The last pairs
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register an entity
+    ///
+    /// Entities without a collider are ignored.
+    ///
+    /// \param entity The entity to register
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void add(Entity* entity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unregister an entity
+    ///
+    /// \param entity The entity to unregister
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void remove(const Entity* entity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unregister every entity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the entities in the hash and dispatch the collisions
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the pairs found by the last update
+    ///
+    /// \return The colliding pairs, as ids of the hash
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<SpatialHash::Pair>& getPairs(void) const;
+};
+
+} // namespace tkd
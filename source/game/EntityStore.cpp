@@ -0,0 +1,302 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "game/EntityStore.hpp"
+#include "game/Entity.hpp"
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Bodies per job, small enough to balance, large enough to amortize a job
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t JOB_GRAIN = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+EntityStore::EntityStore(void)
+    : m_integrator(Entity::GRAVITY, Entity::FRICTION, Entity::MAX_VELOCITY)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t EntityStore::indexOf(Handle handle) const
+{
+    if (!contains(handle))
+        throw std::out_of_range("Invalid entity handle");
+    return (m_indices[handle.slot]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+EntityStore::Handle EntityStore::create(
+    const Vec2f& position,
+    const Vec2f& dimension,
+    Uint8 flags
+)
+{
+    Uint32 slot;
+    if (!m_free.empty()) {
+        slot = m_free.back();
+        m_free.pop_back();
+    } else {
+        slot = static_cast<Uint32>(m_indices.size());
+        m_indices.push_back(0);
+        m_generations.push_back(1);
+    }
+
+    m_indices[slot] = static_cast<Uint32>(m_x.size());
+    m_x.push_back(position.x);
+    m_y.push_back(position.y);
+    m_vx.push_back(0.f);
+    m_vy.push_back(0.f);
+    m_px.push_back(position.x);
+    m_py.push_back(position.y);
+    m_width.push_back(dimension.x);
+    m_height.push_back(dimension.y);
+    m_gravity.push_back((flags & GRAVITY) ? 1.f : 0.f);
+    m_flags.push_back(flags & ~ON_AIR);
+    m_owners.push_back(slot);
+
+    return (Handle{slot, m_generations[slot]});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::destroy(Handle handle)
+{
+    if (!contains(handle))
+        return;
+
+    // The last body fills the hole to keep the arrays packed
+    size_t index = m_indices[handle.slot];
+    size_t last = m_x.size() - 1;
+    if (index != last) {
+        m_x[index] = m_x[last];
+        m_y[index] = m_y[last];
+        m_vx[index] = m_vx[last];
+        m_vy[index] = m_vy[last];
+        m_px[index] = m_px[last];
+        m_py[index] = m_py[last];
+        m_width[index] = m_width[last];
+        m_height[index] = m_height[last];
+        m_gravity[index] = m_gravity[last];
+        m_flags[index] = m_flags[last];
+        m_owners[index] = m_owners[last];
+        m_indices[m_owners[index]] = static_cast<Uint32>(index);
+    }
+
+    m_x.pop_back();
+    m_y.pop_back();
+    m_vx.pop_back();
+    m_vy.pop_back();
+    m_px.pop_back();
+    m_py.pop_back();
+    m_width.pop_back();
+    m_height.pop_back();
+    m_gravity.pop_back();
+    m_flags.pop_back();
+    m_owners.pop_back();
+
+    // Skip 0 on wrap around, it marks invalid handles
+    if (++m_generations[handle.slot] == 0)
+        m_generations[handle.slot] = 1;
+    m_free.push_back(handle.slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool EntityStore::contains(Handle handle) const
+{
+    return (
+        handle.generation != 0 &&
+        handle.slot < m_generations.size() &&
+        m_generations[handle.slot] == handle.generation
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::clear(void)
+{
+    for (Uint32 slot : m_owners) {
+        if (++m_generations[slot] == 0)
+            m_generations[slot] = 1;
+        m_free.push_back(slot);
+    }
+
+    m_x.clear();
+    m_y.clear();
+    m_vx.clear();
+    m_vy.clear();
+    m_px.clear();
+    m_py.clear();
+    m_width.clear();
+    m_height.clear();
+    m_gravity.clear();
+    m_flags.clear();
+    m_owners.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t EntityStore::size(void) const
+{
+    return (m_x.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Integrator::Bodies EntityStore::getBodies(size_t first, size_t last)
+{
+    return (Integrator::Bodies{
+        m_x.data() + first, m_y.data() + first,
+        m_vx.data() + first, m_vy.data() + first,
+        m_gravity.data() + first, last - first
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::update(float deltaT, const Room& room)
+{
+    m_px.assign(m_x.begin(), m_x.end());
+    m_py.assign(m_y.begin(), m_y.end());
+    m_integrator.integrate(getBodies(0, m_x.size()), deltaT);
+    handleCollision(room, 0, m_x.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::update(float deltaT, const Room& room, JobSystem& jobs)
+{
+    m_px.assign(m_x.begin(), m_x.end());
+    m_py.assign(m_y.begin(), m_y.end());
+    m_integrator.setDeltaT(deltaT);
+    jobs.wait(jobs.parallelFor(m_x.size(), JOB_GRAIN,
+    [this, &room](size_t first, size_t last)
+    {
+        m_integrator.integrate(getBodies(first, last));
+        handleCollision(room, first, last);
+    }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::handleCollision(const Room& room, size_t first, size_t last)
+{
+    for (size_t i = first; i < last; i++) {
+        if (!(m_flags[i] & SOLID))
+            continue;
+
+        // The move of the step is swept again from the previous position
+        m_flags[i] |= ON_AIR;
+        Collider collider(
+            Vec2f(m_px[i], m_py[i]), Vec2f(m_width[i], m_height[i])
+        );
+        Vec2f contact = room.slide(
+            collider, Vec2f(m_x[i] - m_px[i], m_y[i] - m_py[i])
+        );
+        Vec2f position = collider.getPosition();
+        m_x[i] = position.x;
+        m_y[i] = position.y;
+
+        if (contact.x != 0.f)
+            m_vx[i] = 0.f;
+        if (contact.y != 0.f) {
+            m_vy[i] = 0.f;
+            if (contact.y < 0.f)
+                m_flags[i] &= ~ON_AIR;
+        }
+
+        if (!room.checkCollision(collider))
+            continue;
+
+        Vec2f resolution = room.resolveCollision(collider);
+
+        m_x[i] += resolution.x;
+        m_y[i] += resolution.y;
+        if (resolution.x != 0.f)
+            m_vx[i] = 0.f;
+        if (resolution.y != 0.f) {
+            m_vy[i] = 0.f;
+            if (resolution.y < 0.f)
+                m_flags[i] &= ~ON_AIR;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::setPosition(Handle handle, const Vec2f& position)
+{
+    size_t index = indexOf(handle);
+    m_x[index] = m_px[index] = position.x;
+    m_y[index] = m_py[index] = position.y;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vec2f EntityStore::getPosition(Handle handle) const
+{
+    size_t index = indexOf(handle);
+    return (Vec2f(m_x[index], m_y[index]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EntityStore::setVelocity(Handle handle, const Vec2f& velocity)
+{
+    size_t index = indexOf(handle);
+    m_vx[index] = velocity.x;
+    m_vy[index] = velocity.y;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vec2f EntityStore::getVelocity(Handle handle) const
+{
+    size_t index = indexOf(handle);
+    return (Vec2f(m_vx[index], m_vy[index]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint8 EntityStore::getFlags(Handle handle) const
+{
+    return (m_flags[indexOf(handle)]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Collider EntityStore::getCollider(size_t index) const
+{
+    return (Collider(
+        Vec2f(m_x[index], m_y[index]),
+        Vec2f(m_width[index], m_height[index])
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vec2f EntityStore::getInterpolatedPosition(size_t index, float alpha) const
+{
+    return (Vec2f(
+        m_px[index] + (m_x[index] - m_px[index]) * alpha,
+        m_py[index] + (m_y[index] - m_py[index]) * alpha
+    ));
+}
+
+} // namespace tkd
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "utils/Vec2.hpp"
+#include "physics/Collider.hpp"
+#include "physics/Integrator.hpp"
+#include "game/Room.hpp"
+#include "utils/JobSystem.hpp"
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Storage for large amounts of simple physics bodies
+///
+/// Projectiles, pickups and the like are kept as structure of arrays: every
+/// property lives in its own contiguous array, so the update walks memory
+/// linearly instead of chasing one heap object per body. The arrays stay
+/// packed by moving the last body into the hole left by a removal, handles
+/// go through a slot table to remain valid across these moves.
+///
+///////////////////////////////////////////////////////////////////////////////
+class EntityStore
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stable reference to a body of the store
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Handle
+    {
+        Uint32 slot = 0;        //<! The slot of the body
+        Uint32 generation = 0;  //<! The generation of the slot, 0 is invalid
+
+        bool operator==(const Handle& other) const = default;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body flags
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum Flags : Uint8
+    {
+        GRAVITY = 1 << 0,       //<! The body falls
+        SOLID   = 1 << 1,       //<! The body collides with the room
+        ON_AIR  = 1 << 2        //<! The body touched no ground last update
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<float> m_x;             //<! The horizontal positions
+    std::vector<float> m_y;             //<! The vertical positions
+    std::vector<float> m_vx;            //<! The horizontal velocities
+    std::vector<float> m_vy;            //<! The vertical velocities
+    std::vector<float> m_px;            //<! The horizontal positions before
+    std::vector<float> m_py;            //<! The vertical positions before
+    std::vector<float> m_width;         //<! The collider widths
+    std::vector<float> m_height;        //<! The collider heights
+    std::vector<float> m_gravity;       //<! The gravity scales, 0 or 1
+    std::vector<Uint8> m_flags;         //<! The body flags
+    std::vector<Uint32> m_owners;       //<! The slot of each body
+    std::vector<Uint32> m_indices;      //<! The body index of each slot
+    std::vector<Uint32> m_generations;  //<! The generation of each slot
+    std::vector<Uint32> m_free;         //<! The unused slots
+    Integrator m_integrator;            //<! The velocity and position step
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default store constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    EntityStore(void);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the body index of a handle
+    ///
+    /// \param handle The handle of the body
+    ///
+    /// \throw std::out_of_range If the handle is not valid
+    ///
+    /// \return The index of the body in the arrays
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t indexOf(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Resolve the collisions of the solid bodies with the room
+    ///
+    /// Only the bodies of the range are written, so disjoint ranges can run
+    /// on several threads at once.
+    ///
+    /// \param room The room to check collision with
+    /// \param first The index of the first body
+    /// \param last The index past the last body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void handleCollision(const Room& room, size_t first, size_t last);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the arrays of a range of bodies for the integrator
+    ///
+    /// \param first The index of the first body
+    /// \param last The index past the last body
+    ///
+    /// \return The bodies of the range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Integrator::Bodies getBodies(size_t first, size_t last);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a body to the store
+    ///
+    /// \param position The position of the body
+    /// \param dimension The dimension of the body collider
+    /// \param flags The flags of the body
+    ///
+    /// \return The handle of the new body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Handle create(
+        const Vec2f& position,
+        const Vec2f& dimension,
+        Uint8 flags = GRAVITY | SOLID
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove a body, invalidating its handle
+    ///
+    /// Handles of the other bodies stay valid. Invalid handles are ignored.
+    ///
+    /// \param handle The handle of the body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void destroy(Handle handle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if a handle refers to a body of the store
+    ///
+    /// \param handle The handle to check
+    ///
+    /// \return True if the body still exists
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool contains(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every body, invalidating all the handles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of bodies
+    ///
+    /// \return The number of bodies in the store
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Update the physics of every body and resolve the collision
+    /// with the room
+    ///
+    /// Same rules as Entity::updatePhysics, applied array by array.
+    ///
+    /// \param deltaT The delta time to apply on calculation
+    /// \param room The room to check collision with
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(float deltaT, const Room& room);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Update the bodies like update, split over the job system
+    ///
+    /// Each job integrates a range of bodies then sweeps them against the
+    /// room. The call returns once every range is done.
+    ///
+    /// \param deltaT The delta time to apply on calculation
+    /// \param room The room to check collision with
+    /// \param jobs The job system to run the ranges on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(float deltaT, const Room& room, JobSystem& jobs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the position of a body
+    ///
+    /// The body is moved without interpolation from its last position.
+    ///
+    /// \param handle The handle of the body
+    /// \param position The new position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setPosition(Handle handle, const Vec2f& position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the position of a body
+    ///
+    /// \param handle The handle of the body
+    ///
+    /// \return The position of the body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f getPosition(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the velocity of a body
+    ///
+    /// \param handle The handle of the body
+    /// \param velocity The new velocity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setVelocity(Handle handle, const Vec2f& velocity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the velocity of a body
+    ///
+    /// \param handle The handle of the body
+    ///
+    /// \return The velocity of the body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f getVelocity(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the flags of a body
+    ///
+    /// \param handle The handle of the body
+    ///
+    /// \return The flags of the body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint8 getFlags(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the collider of a body by its index in the arrays
+    ///
+    /// Indices run from 0 to size() and change when bodies are destroyed,
+    /// they are meant for iterating, not for keeping.
+    ///
+    /// \param index The index of the body
+    ///
+    /// \return The collider of the body
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Collider getCollider(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the position of a body between the two last updates
+    ///
+    /// \param index The index of the body
+    /// \param alpha The time since the last update, as a fraction of a step
+    ///
+    /// \return The blended position, for rendering
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f getInterpolatedPosition(size_t index, float alpha) const;
+};
+
+} // namespace tkd
@@ -36,11 +36,14 @@
 namespace tkd
 {
 
+///////////////////////////////////////////////////////////////////////////////
+const char* Player::SPRITE_KEY = "sprites/player.png";
+
 ///////////////////////////////////////////////////////////////////////////////
 Player::Player(void)
-    : Character(Vec2f(400.f, 50.f), 100.f)
+    : Character(Vec2f(PLAYER_SPAWN_X, PLAYER_SPAWN_Y), 100.f)
 {
-    Vec2f dimension(10.f, 20.f);
+    Vec2f dimension(PLAYER_WIDTH, PLAYER_HEIGHT);
 
     m_shape.setPosition(m_position);
     m_shape.setSize(dimension);
@@ -53,7 +56,6 @@ Player::Player(void)
 void Player::update(float deltaT)
 {
     IGNORE(deltaT);
-    m_shape.setPosition(m_position);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -63,9 +65,27 @@ void Player::handleCollision(Entity* other)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Player::render(sf::RenderWindow& window)
+void Player::render(sf::RenderWindow& window, float alpha)
 {
+    m_shape.setPosition(getInterpolatedPosition(alpha));
     window.draw(m_shape);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Player::render(
+    SpriteBatch& batch,
+    const sf::Texture& texture,
+    const sf::IntRect& rect,
+    float alpha
+) const
+{
+    Vec2f position = getInterpolatedPosition(alpha);
+    sf::Vector2f size = m_shape.getSize();
+    sf::Transform transform;
+
+    transform.translate(position.x, position.y);
+    transform.scale(size.x / rect.width, size.y / rect.height);
+    batch.add(texture, rect, transform);
+}
+
 } // namespace tkd
@@ -33,6 +33,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "game/Character.hpp"
+#include "core/SpriteBatch.hpp"
+#include <SFML/Graphics.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -46,6 +48,12 @@ namespace tkd
 ///////////////////////////////////////////////////////////////////////////////
 class Player : public Character
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Key of the player image in the assets pack
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* SPRITE_KEY;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private properties
@@ -80,9 +88,26 @@ public:
     /// \brief Render the entity
     ///
     /// \param window The window to render the entity on
+    /// \param alpha The time since the last step, as a fraction of a step
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void render(sf::RenderWindow& window, float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add the entity to a sprite batch, stretched to its size
+    ///
+    /// \param batch The batch to add the quad to
+    /// \param texture The texture holding the sprite
+    /// \param rect The area of the sprite in the texture
+    /// \param alpha The time since the last step, as a fraction of a step
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void render(sf::RenderWindow& window) override;
+    void render(
+        SpriteBatch& batch,
+        const sf::Texture& texture,
+        const sf::IntRect& rect,
+        float alpha
+    ) const;
 };
 
 } // namespace tkd
@@ -37,89 +37,90 @@ namespace tkd
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-// TEMPORARY
-Room::Room(void)
-{
-    {
-        Vec2f position(0.f, 500.f);
-        Vec2f dimension(800.f, 20.f);
+const char* Room::DEFAULT_KEY = "rooms/start.map";
 
-        m_colliders.push_back(Collider(position, dimension));
-        m_tiles.push_back(sf::RectangleShape());
+///////////////////////////////////////////////////////////////////////////////
+static TileMap defaultMap(void)
+{
+    TileMap map(40, 30);
+
+    // The floor, then the wall on the left
+    for (Uint32 x = 0; x < map.getWidth(); x++)
+        map.setTile(x, 25, 1, true);
+    for (Uint32 y = 0; y < 20; y++)
+        map.setTile(5, y, 2, true);
+    return (map);
+}
 
-        m_tiles[0].setFillColor(sf::Color::Green);
-        m_tiles[0].setPosition(position);
-        m_tiles[0].setSize(dimension);
-    }
+///////////////////////////////////////////////////////////////////////////////
+Room::Room(void)
+    : Room(defaultMap())
+{}
 
-    {
-        Vec2f position(100.f, 0.f);
-        Vec2f dimension(20.f, 400.f);
+///////////////////////////////////////////////////////////////////////////////
+Room::Room(const TileMap& map)
+    : m_map(map)
+{}
 
-        m_colliders.push_back(Collider(position, dimension));
-        m_tiles.push_back(sf::RectangleShape());
+///////////////////////////////////////////////////////////////////////////////
+bool Room::checkCollision(const Collider& collider) const
+{
+    return (m_map.checkCollision(collider));
+}
 
-        m_tiles[1].setFillColor(sf::Color::Blue);
-        m_tiles[1].setPosition(position);
-        m_tiles[1].setSize(dimension);
-    }
+///////////////////////////////////////////////////////////////////////////////
+Vec2f Room::resolveCollision(const Collider& collider) const
+{
+    return (m_map.resolveCollision(collider));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool Room::checkCollision(const Collider& collider) const
+float Room::sweep(
+    const Collider& collider,
+    const Vec2f& motion,
+    Vec2f& normal
+) const
 {
-    for (const auto& bound : m_colliders) {
-        if (bound | collider)
-            return (true);
-    }
-    return (false);
+    return (m_map.sweep(collider, motion, normal));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Vec2f Room::resolveCollision(const Collider& collider) const
+Vec2f Room::slide(Collider& collider, Vec2f motion) const
 {
-    Vec2f resolution(0.f);
-
-    for (const auto& bound : m_colliders) {
-        if (!(bound | collider))
-            continue;
-        Vec2f bpos = bound.getPosition();
-        Vec2f bdim = bound.getDimension();
-        Vec2f cpos = collider.getPosition();
-        Vec2f cdim = collider.getDimension();
-
-        Vec2f bmid = bpos + (bdim * .5f);
-        Vec2f cmid = cpos + (cdim * .5f);
-
-        Vec2f overlap(
-            (bdim.x + cdim.x) * .5f - std::abs(bmid.x - cmid.x),
-            (bdim.y + cdim.y) * .5f - std::abs(bmid.y - cmid.y)
-        );
-
-        static const float EPSILON = 0.0001f;
-
-        if (overlap.x <= EPSILON && overlap.y <= EPSILON)
-            continue;
-
-        Vec2f direction(
-            (cmid.x < bmid.x) ? -1.f : 1.f,
-            (cmid.y < bmid.y) ? -1.f : 1.f
-        );
-
-        if (overlap.x < overlap.y)
-            resolution.x += overlap.x * direction.x;
-        else
-            resolution.y += overlap.y * direction.y;
+    Vec2f contact(0.f);
+
+    // Each hit blocks one axis, so a third sweep would have nothing to move
+    for (int i = 0; i < 2 && (motion.x != 0.f || motion.y != 0.f); i++) {
+        Vec2f normal;
+        float time = sweep(collider, motion, normal);
+
+        collider.setPosition(collider.getPosition() + motion * time);
+        if (time >= 1.f)
+            break;
+
+        motion *= 1.f - time;
+        if (normal.x != 0.f) {
+            motion.x = 0.f;
+            contact.x = normal.x;
+        }
+        if (normal.y != 0.f) {
+            motion.y = 0.f;
+            contact.y = normal.y;
+        }
     }
+    return (contact);
+}
 
-    return (resolution);
+///////////////////////////////////////////////////////////////////////////////
+void Room::setTile(Uint32 x, Uint32 y, Uint8 tile, bool solid)
+{
+    m_map.setTile(x, y, tile, solid);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Room::render(sf::RenderWindow& window)
+const TileMap& Room::getMap(void) const
 {
-    for (const auto& tile : m_tiles)
-        window.draw(tile);
+    return (m_map);
 }
 
 } // namespace tkd
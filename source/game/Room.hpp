@@ -34,8 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "utils/Vec2.hpp"
 #include "physics/Collider.hpp"
-#include <SFML/Graphics.hpp>
-#include <vector>
+#include "game/TileMap.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -44,22 +43,43 @@ namespace tkd
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Room made of a tile layer
+///
+/// The room only holds what the simulation needs, so it is shared by the
+/// client and the headless server. RoomRenderer draws it on the client.
+/// Queries go through the tile map, which only looks at the tiles under a
+/// box, so their cost does not depend on the size of the room.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class Room
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Key of the first room in the assets pack
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* DEFAULT_KEY;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private room properties
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<sf::RectangleShape> m_tiles;    //<! The tiles set
-    std::vector<Collider> m_colliders;          //<! The collision box
+    TileMap m_map;                              //<! The tile layer
 
 public:
-    // TEMPORARY
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create the built-in room, used when no room is packed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
     Room(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create a room from a tile map
+    ///
+    /// \param map The tile layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Room(const TileMap& map);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Check the collision with another collider
@@ -82,12 +102,56 @@ public:
     Vec2f resolveCollision(const Collider& collider) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Render the room on the window
+    /// \brief Find when a moving collider first hits the room
+    ///
+    /// \param collider The collider at the start of the step
+    /// \param motion The displacement of the collider during the step
+    /// \param normal Set to the face that is hit
+    ///
+    /// \return The time of impact in [0, 1], 1 if there is none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float sweep(
+        const Collider& collider,
+        const Vec2f& motion,
+        Vec2f& normal
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move a collider through the room, sliding along what it hits
+    ///
+    /// The move stops at the time of impact instead of going through thin
+    /// walls, whatever the speed, then the rest of the motion continues
+    /// along the face that was hit.
+    ///
+    /// \param collider The collider to move
+    /// \param motion The displacement of the collider during the step
+    ///
+    /// \return The normals of the faces hit on each axis, 0 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f slide(Collider& collider, Vec2f motion) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change a tile
+    ///
+    /// Renderers of the room must be told with RoomRenderer::invalidate.
+    ///
+    /// \param x The column of the tile
+    /// \param y The row of the tile
+    /// \param tile The tile, 0 for empty
+    /// \param solid Whether the tile blocks movement
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setTile(Uint32 x, Uint32 y, Uint8 tile, bool solid);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the tile layer of the room
     ///
-    /// \param window The window to display on
+    /// \return The tile map
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void render(sf::RenderWindow& window);
+    const TileMap& getMap(void) const;
 };
 
 } // namespace tkd
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "game/RoomRenderer.hpp"
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+RoomRenderer::RoomRenderer(void)
+    : m_chunkColumns(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void RoomRenderer::layout(const TileMap& map)
+{
+    m_chunkColumns = (map.getWidth() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    Uint32 rows = (map.getHeight() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunks.assign(
+        static_cast<size_t>(m_chunkColumns) * rows,
+        Chunk{sf::VertexArray(sf::Triangles), true}
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RoomRenderer::buildChunk(size_t index, const TileMap& map)
+{
+    static const sf::Color PALETTE[] = {
+        sf::Color::Transparent, sf::Color::Green, sf::Color::Blue,
+        sf::Color::Red, sf::Color::Yellow, sf::Color::Cyan,
+        sf::Color::Magenta, sf::Color::White
+    };
+
+    Chunk& chunk = m_chunks[index];
+    chunk.vertices.clear();
+    chunk.dirty = false;
+
+    Uint32 left = (index % m_chunkColumns) * CHUNK_SIZE;
+    Uint32 top = (index / m_chunkColumns) * CHUNK_SIZE;
+    Uint32 right = std::min(left + CHUNK_SIZE, map.getWidth());
+    Uint32 bottom = std::min(top + CHUNK_SIZE, map.getHeight());
+    float size = map.getTileSize();
+
+    for (Uint32 y = top; y < bottom; y++) {
+        for (Uint32 x = left; x < right; x++) {
+            Uint8 tile = map.getTile(x, y);
+            if (tile == 0)
+                continue;
+
+            sf::Color color = PALETTE[tile % std::size(PALETTE)];
+            sf::Vector2f a(x * size, y * size);
+            sf::Vector2f b(a.x + size, a.y);
+            sf::Vector2f c(a.x + size, a.y + size);
+            sf::Vector2f d(a.x, a.y + size);
+            for (const sf::Vector2f& corner : {a, b, c, a, c, d})
+                chunk.vertices.append(sf::Vertex(corner, color));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RoomRenderer::render(sf::RenderWindow& window, const Room& room)
+{
+    const TileMap& map = room.getMap();
+
+    if (m_chunks.empty())
+        layout(map);
+    if (m_chunks.empty())
+        return;
+
+    // Only the chunks overlapping the view are visited
+    const sf::View& view = window.getView();
+    float span = CHUNK_SIZE * map.getTileSize();
+    sf::Vector2f min = view.getCenter() - view.getSize() / 2.f;
+    sf::Vector2f max = view.getCenter() + view.getSize() / 2.f;
+
+    Int32 rows = static_cast<Int32>(m_chunks.size() / m_chunkColumns);
+    Int32 left = std::max(static_cast<Int32>(std::floor(min.x / span)), 0);
+    Int32 top = std::max(static_cast<Int32>(std::floor(min.y / span)), 0);
+    Int32 right = std::min(
+        static_cast<Int32>(std::floor(max.x / span)),
+        static_cast<Int32>(m_chunkColumns) - 1
+    );
+    Int32 bottom = std::min(
+        static_cast<Int32>(std::floor(max.y / span)), rows - 1
+    );
+
+    // One draw call per chunk, whatever the number of tiles in it
+    for (Int32 y = top; y <= bottom; y++) {
+        for (Int32 x = left; x <= right; x++) {
+            size_t index = static_cast<size_t>(y) * m_chunkColumns + x;
+            if (m_chunks[index].dirty)
+                buildChunk(index, map);
+            if (m_chunks[index].vertices.getVertexCount() != 0)
+                window.draw(m_chunks[index].vertices);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RoomRenderer::invalidate(void)
+{
+    m_chunks.clear();
+    m_chunkColumns = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RoomRenderer::invalidate(Uint32 x, Uint32 y)
+{
+    size_t index = static_cast<size_t>(y / CHUNK_SIZE) * m_chunkColumns
+        + x / CHUNK_SIZE;
+
+    if (index < m_chunks.size())
+        m_chunks[index].dirty = true;
+}
+
+} // namespace tkd
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "game/Room.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Draw the tile layer of a room, baked in chunk meshes
+///
+/// Kept apart from Room so that the simulation builds without the SFML
+/// graphics module. The meshes are laid out on the first render, and a
+/// chunk is only rebuilt once one of its tiles is invalidated.
+///
+///////////////////////////////////////////////////////////////////////////////
+class RoomRenderer
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Width and height in tiles of a render chunk
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 CHUNK_SIZE = 16;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tiles of a square of the map baked in one mesh
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        sf::VertexArray vertices;               //<! Two triangles per tile
+        bool dirty;                             //<! Tiles changed since
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Chunk> m_chunks;                //<! The meshes, row by row
+    Uint32 m_chunkColumns;                      //<! The chunks per row
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    RoomRenderer(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Render a room on the window
+    ///
+    /// Only the chunks inside the current view of the window are drawn.
+    ///
+    /// \param window The window to display on
+    /// \param room The room to draw
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void render(sf::RenderWindow& window, const Room& room);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every mesh, to be called when the room is replaced
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void invalidate(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuild the chunk of a tile on the next render
+    ///
+    /// \param x The column of the changed tile
+    /// \param y The row of the changed tile
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void invalidate(Uint32 x, Uint32 y);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size the chunk grid to the map of the room
+    ///
+    /// \param map The tile layer to cover
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void layout(const TileMap& map);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuild the mesh of a chunk from the tile layer
+    ///
+    /// \param index The index of the chunk
+    /// \param map The tile layer to read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void buildChunk(size_t index, const TileMap& map);
+};
+
+} // namespace tkd
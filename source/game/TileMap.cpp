@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "game/TileMap.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <sstream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+const char* TileMap::SIGNATURE = "TKDROOM1";
+
+///////////////////////////////////////////////////////////////////////////////
+TileMap::TileMap(Uint32 width, Uint32 height, float tileSize)
+    : m_width(width)
+    , m_height(height)
+    , m_tileSize(tileSize)
+    , m_tiles(static_cast<size_t>(width) * height, 0)
+    , m_solid((static_cast<size_t>(width) * height + 63) / 64, 0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TileMap::cells(const Collider& collider, Vec2i& min, Vec2i& max) const
+{
+    Vec2f start = collider.getPosition() / m_tileSize;
+    Vec2f end = (collider.getPosition() + collider.getDimension())
+        / m_tileSize;
+
+    // Boxes only touching a tile edge do not overlap the tile. The range is
+    // clamped before leaving float so a huge box cannot overflow the cast,
+    // and fmax maps NaN to the bound so a NaN box covers no tile.
+    float width = static_cast<float>(m_width);
+    float height = static_cast<float>(m_height);
+    min.x = static_cast<Int32>(
+        std::fmin(std::fmax(std::floor(start.x), 0.f), width)
+    );
+    min.y = static_cast<Int32>(
+        std::fmin(std::fmax(std::floor(start.y), 0.f), height)
+    );
+    max.x = static_cast<Int32>(
+        std::fmin(std::fmax(std::ceil(end.x) - 1.f, -1.f), width - 1.f)
+    );
+    max.y = static_cast<Int32>(
+        std::fmin(std::fmax(std::ceil(end.y) - 1.f, -1.f), height - 1.f)
+    );
+    return (min.x <= max.x && min.y <= max.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TileMap TileMap::load(const UData& data)
+{
+    const size_t header = 8 + sizeof(Uint32) * 2 + sizeof(float);
+    if (data.size() < header || std::memcmp(data.data(), SIGNATURE, 8) != 0)
+        throw std::runtime_error("Invalid tile map signature");
+
+    Uint32 width = 0, height = 0;
+    float tileSize = 0.f;
+    std::memcpy(&width, data.data() + 8, sizeof(Uint32));
+    std::memcpy(&height, data.data() + 12, sizeof(Uint32));
+    std::memcpy(&tileSize, data.data() + 16, sizeof(float));
+    if (!(tileSize > 0.f))
+        throw std::runtime_error("Invalid tile size");
+
+    size_t count = static_cast<size_t>(width) * height;
+    size_t words = (count + 63) / 64;
+    if (
+        count > data.size() ||
+        data.size() != header + count + words * sizeof(Uint64)
+    )
+        throw std::runtime_error("Truncated tile map");
+
+    TileMap map(width, height, tileSize);
+    std::memcpy(map.m_tiles.data(), data.data() + header, count);
+    std::memcpy(
+        map.m_solid.data(), data.data() + header + count,
+        words * sizeof(Uint64)
+    );
+    return (map);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TileMap TileMap::parse(const std::string& text, float tileSize)
+{
+    std::vector<std::string> rows;
+    std::istringstream iss(text);
+    size_t width = 0;
+
+    for (std::string line; std::getline(iss, line);) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        width = std::max(width, line.size());
+        rows.push_back(line);
+    }
+
+    TileMap map(width, rows.size(), tileSize);
+    for (size_t y = 0; y < rows.size(); y++) {
+        for (size_t x = 0; x < rows[y].size(); x++) {
+            char c = rows[y][x];
+            if (c == '#')
+                map.setTile(x, y, 1, true);
+            else if (c >= '1' && c <= '9')
+                map.setTile(x, y, c - '0', true);
+            else if (c >= 'a' && c <= 'z')
+                map.setTile(x, y, c - 'a' + 1, false);
+            else if (c != '.' && c != ' ')
+                throw std::runtime_error(
+                    std::string("Unknown tile: ") + c
+                );
+        }
+    }
+    return (map);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData TileMap::save(void) const
+{
+    UData data(8);
+    std::memcpy(data.data(), SIGNATURE, 8);
+
+    auto append = [&data](const void* bytes, size_t size){
+        const UByte* begin = static_cast<const UByte*>(bytes);
+        data.insert(data.end(), begin, begin + size);
+    };
+
+    append(&m_width, sizeof(m_width));
+    append(&m_height, sizeof(m_height));
+    append(&m_tileSize, sizeof(m_tileSize));
+    append(m_tiles.data(), m_tiles.size());
+    append(m_solid.data(), m_solid.size() * sizeof(Uint64));
+    return (data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TileMap::setTile(Uint32 x, Uint32 y, Uint8 tile, bool solid)
+{
+    if (x >= m_width || y >= m_height)
+        throw std::out_of_range("Tile outside the map");
+
+    size_t index = static_cast<size_t>(y) * m_width + x;
+    m_tiles[index] = tile;
+    if (solid)
+        m_solid[index / 64] |= Uint64(1) << (index % 64);
+    else
+        m_solid[index / 64] &= ~(Uint64(1) << (index % 64));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint8 TileMap::getTile(Int32 x, Int32 y) const
+{
+    if (
+        x < 0 || y < 0 ||
+        x >= static_cast<Int32>(m_width) || y >= static_cast<Int32>(m_height)
+    ) return (0);
+    return (m_tiles[static_cast<size_t>(y) * m_width + x]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TileMap::isSolid(Int32 x, Int32 y) const
+{
+    if (
+        x < 0 || y < 0 ||
+        x >= static_cast<Int32>(m_width) || y >= static_cast<Int32>(m_height)
+    ) return (false);
+
+    size_t index = static_cast<size_t>(y) * m_width + x;
+    return ((m_solid[index / 64] >> (index % 64)) & 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TileMap::checkCollision(const Collider& collider) const
+{
+    Vec2i min, max;
+    if (!cells(collider, min, max))
+        return (false);
+
+    for (Int32 y = min.y; y <= max.y; y++)
+        for (Int32 x = min.x; x <= max.x; x++)
+            if (isSolid(x, y))
+                return (true);
+    return (false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vec2f TileMap::resolveCollision(const Collider& collider) const
+{
+    static const float EPSILON = 0.0001f;
+
+    Vec2f resolution(0.f);
+    Vec2i min, max;
+    if (!cells(collider, min, max))
+        return (resolution);
+
+    Vec2f cdim = collider.getDimension();
+    Vec2f cmid = collider.getPosition() + (cdim * .5f);
+
+    for (Int32 y = min.y; y <= max.y; y++) {
+        for (Int32 x = min.x; x <= max.x; x++) {
+            if (!isSolid(x, y))
+                continue;
+
+            Vec2f bmid(
+                (static_cast<float>(x) + .5f) * m_tileSize,
+                (static_cast<float>(y) + .5f) * m_tileSize
+            );
+            Vec2f overlap(
+                (m_tileSize + cdim.x) * .5f - std::abs(bmid.x - cmid.x),
+                (m_tileSize + cdim.y) * .5f - std::abs(bmid.y - cmid.y)
+            );
+            if (overlap.x <= EPSILON && overlap.y <= EPSILON)
+                continue;
+
+            Vec2i direction(
+                (cmid.x < bmid.x) ? -1 : 1,
+                (cmid.y < bmid.y) ? -1 : 1
+            );
+
+            // Faces against another solid tile are inside the wall
+            bool openX = !isSolid(x + direction.x, y);
+            bool openY = !isSolid(x, y + direction.y);
+            if (!openX && !openY)
+                continue;
+
+            // Overlapping tiles of a same face push the same way, the
+            // deepest one is kept instead of adding them up
+            if (openX && (overlap.x < overlap.y || !openY)) {
+                float push = overlap.x * direction.x;
+                if (std::abs(push) > std::abs(resolution.x))
+                    resolution.x = push;
+            } else {
+                float push = overlap.y * direction.y;
+                if (std::abs(push) > std::abs(resolution.y))
+                    resolution.y = push;
+            }
+        }
+    }
+
+    return (resolution);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float TileMap::sweep(
+    const Collider& collider,
+    const Vec2f& motion,
+    Vec2f& normal
+) const
+{
+    // The tiles around the whole path, including the ones only touched
+    static const float MARGIN = 0.01f;
+    Vec2f start = collider.getPosition();
+    Vec2f end = start + motion;
+    Vec2f min(std::min(start.x, end.x), std::min(start.y, end.y));
+    Vec2f max = Vec2f(std::max(start.x, end.x), std::max(start.y, end.y))
+        + collider.getDimension();
+
+    Vec2i first, last;
+    if (!cells(Collider(min - MARGIN, max - min + MARGIN * 2.f), first, last))
+        return (1.f);
+
+    float time = 1.f;
+    for (Int32 y = first.y; y <= last.y; y++) {
+        for (Int32 x = first.x; x <= last.x; x++) {
+            if (!isSolid(x, y))
+                continue;
+
+            Collider tile(
+                Vec2f(static_cast<float>(x), static_cast<float>(y))
+                    * m_tileSize,
+                Vec2f(m_tileSize)
+            );
+            Vec2f face;
+            float hit = collider.sweep(motion, tile, face);
+            if (hit >= time)
+                continue;
+
+            // Faces against another solid tile are inside the wall
+            Int32 nx = x + static_cast<Int32>(face.x);
+            Int32 ny = y + static_cast<Int32>(face.y);
+            if (isSolid(nx, ny))
+                continue;
+
+            time = hit;
+            normal = face;
+        }
+    }
+
+    return (time);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 TileMap::getWidth(void) const
+{
+    return (m_width);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 TileMap::getHeight(void) const
+{
+    return (m_height);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float TileMap::getTileSize(void) const
+{
+    return (m_tileSize);
+}
+
+} // namespace tkd
@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "utils/Vec2.hpp"
+#include "physics/Collider.hpp"
+#include <vector>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Grid of tiles with a solidity bitset
+///
+/// A tile is one byte, 0 being empty, and its solidity one bit. Collision
+/// queries read the cells a box overlaps directly, no collider is stored
+/// per tile.
+///
+/// The serialized form is the signature, the width and the height in
+/// tiles, the tile size, the tile bytes row by row, then the solidity
+/// bitset as 64 bits words.
+///
+///////////////////////////////////////////////////////////////////////////////
+class TileMap
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default size of a tile in pixels
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float DEFAULT_TILE_SIZE = 20.f;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 m_width;                 //<! The width in tiles
+    Uint32 m_height;                //<! The height in tiles
+    float m_tileSize;               //<! The size of a tile in pixels
+    std::vector<Uint8> m_tiles;     //<! The tiles, row by row
+    std::vector<Uint64> m_solid;    //<! One solidity bit per tile
+
+private:
+    static const char* SIGNATURE;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create an empty map
+    ///
+    /// \param width The width in tiles
+    /// \param height The height in tiles
+    /// \param tileSize The size of a tile in pixels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TileMap(
+        Uint32 width = 0,
+        Uint32 height = 0,
+        float tileSize = DEFAULT_TILE_SIZE
+    );
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the range of tiles overlapped by a box
+    ///
+    /// \param collider The box
+    /// \param min The first tile overlapped
+    /// \param max The last tile overlapped
+    ///
+    /// \return False if the box does not overlap the map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool cells(const Collider& collider, Vec2i& min, Vec2i& max) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read a map from its serialized form
+    ///
+    /// \param data The serialized map
+    ///
+    /// \return The map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static TileMap load(const UData& data);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build a map from a text layout, one line per row
+    ///
+    /// A '.' or a space is empty, a digit is a solid tile, '#' being tile 1,
+    /// and a lowercase letter is a decoration tile, 'a' being tile 1.
+    ///
+    /// \param text The layout
+    /// \param tileSize The size of a tile in pixels
+    ///
+    /// \return The map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static TileMap parse(
+        const std::string& text,
+        float tileSize = DEFAULT_TILE_SIZE
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the map in its serialized form
+    ///
+    /// \return The serialized map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UData save(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change a tile
+    ///
+    /// \param x The column of the tile
+    /// \param y The row of the tile
+    /// \param tile The tile, 0 for empty
+    /// \param solid Whether the tile blocks movement
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setTile(Uint32 x, Uint32 y, Uint8 tile, bool solid);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a tile
+    ///
+    /// \param x The column of the tile
+    /// \param y The row of the tile
+    ///
+    /// \return The tile, 0 if empty or outside the map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint8 getTile(Int32 x, Int32 y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if a tile blocks movement
+    ///
+    /// \param x The column of the tile
+    /// \param y The row of the tile
+    ///
+    /// \return True if the tile is solid, false if empty or outside the map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isSolid(Int32 x, Int32 y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check the collision with a collider
+    ///
+    /// \param collider The collider to check collision with
+    ///
+    /// \return True if the collider overlaps a solid tile
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool checkCollision(const Collider& collider) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Resolve the collision with a collider
+    ///
+    /// A tile only pushes through its faces that are not against another
+    /// solid tile, so a box sliding along a row of tiles is not caught on
+    /// the edges between them.
+    ///
+    /// \param collider The collider to resolve
+    ///
+    /// \return The displacement moving the collider out of the tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f resolveCollision(const Collider& collider) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find when a moving collider first hits a solid tile
+    ///
+    /// Like resolveCollision, faces against another solid tile are ignored.
+    ///
+    /// \param collider The collider at the start of the step
+    /// \param motion The displacement of the collider during the step
+    /// \param normal Set to the face that is hit
+    ///
+    /// \return The time of impact in [0, 1], 1 if there is none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float sweep(
+        const Collider& collider,
+        const Vec2f& motion,
+        Vec2f& normal
+    ) const;
+
+    Uint32 getWidth(void) const;
+    Uint32 getHeight(void) const;
+    float getTileSize(void) const;
+};
+
+} // namespace tkd
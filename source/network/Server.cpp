@@ -28,12 +28,16 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "network/Server.hpp"
+#include "game/Entity.hpp"
 #include <iostream>
 #include <set>
 #include <iostream>
 #include <csignal>
 #include <cstdlib>
 #include <thread>
+#include <mutex>
+#include <algorithm>
+#include <cmath>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -42,8 +46,18 @@ namespace tkd
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Server::Server(Uint32 port)
+// Where the client spawns its player, and the size of its collider
+///////////////////////////////////////////////////////////////////////////////
+static const Vec2f PLAYER_SPAWN(
+    Entity::PLAYER_SPAWN_X, Entity::PLAYER_SPAWN_Y
+);
+static const Vec2f PLAYER_SIZE(Entity::PLAYER_WIDTH, Entity::PLAYER_HEIGHT);
+
+///////////////////////////////////////////////////////////////////////////////
+Server::Server(Uint32 port, const Room& room)
     : m_nextPlayerId(0)
+    , m_room(room)
+    , m_lastUpdate(std::chrono::steady_clock::now())
 {
     m_socket = socket(AF_INET, SOCK_STREAM, 0);
 
@@ -91,13 +105,23 @@ Server::~Server()
 ///////////////////////////////////////////////////////////////////////////////
 void Server::run(void)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     handleNewConnections();
     handleClientMessages();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Server::update(void)
-{}
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = std::chrono::duration<float>(now - m_lastUpdate).count();
+
+    m_lastUpdate = now;
+    for (Uint32 steps = m_timestep.advance(elapsed); steps > 0; steps--)
+        m_bodies.update(m_timestep.getStep(), m_room, m_jobs);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 void Server::handleNewConnections(void)
@@ -121,16 +145,22 @@ void Server::handleNewConnections(void)
 
             packet << m_clients.size();
             for (const auto& client : m_clients)
-                packet << client.first << client.second->position;
+                packet << client.first
+                    << m_bodies.getPosition(client.second->body);
             send(socket, packet.data(), packet.size(), 0);
         }
 
-        m_clients[id] = std::make_unique<ClientInfo>(socket, Vec2f(0.f));
+        // Players are moved by their client, which applies the gravity,
+        // the server body only collides so it is kept out of the walls
+        m_clients[id] = std::make_unique<ClientInfo>(
+            socket,
+            m_bodies.create(PLAYER_SPAWN, PLAYER_SIZE, EntityStore::SOLID)
+        );
 
         {
             Packet packet(Packet::Type::PlayerJoined);
 
-            packet << id << Vec2f(0.f);
+            packet << id << PLAYER_SPAWN;
             broadcastPacket(packet, socket);
         }
 
@@ -155,9 +185,17 @@ void Server::handleClientMessages(void)
             switch (type) {
                 case Packet::Type::PlayerMove:
                 {
-                    packet >> m_clients[it->first]->position;
-                    result << it->first << m_clients[it->first]->position;
-                    broadcastPacket(result, m_clients[it->first]->socket);
+                    Vec2f position;
+
+                    packet >> position;
+                    if (
+                        !std::isfinite(position.x) ||
+                        !std::isfinite(position.y)
+                    )
+                        break;
+                    position = movePlayer(*it->second, position);
+                    result << it->first << position;
+                    broadcastPacket(result, it->second->socket);
                     break;
                 }
                 default:
@@ -191,6 +229,7 @@ void Server::handleDisconnections(
 
     closesocket(it->second->socket);
     broadcastPacket(packet, it->second->socket);
+    m_bodies.destroy(it->second->body);
     m_clients.erase(it);
     std::cout << "Client " << id << " disconnected" << std::endl;
 }
@@ -204,4 +243,32 @@ void Server::broadcastPacket(Packet& packet, Socket socket)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Vec2f Server::movePlayer(const ClientInfo& client, const Vec2f& position)
+{
+    Collider collider(m_bodies.getPosition(client.body), PLAYER_SIZE);
+
+    // A body left inside a wall is pushed out before moving
+    if (m_room.checkCollision(collider))
+        collider.setPosition(
+            collider.getPosition() + m_room.resolveCollision(collider)
+        );
+
+    // The target is kept inside the room so the sweep stays bounded
+    const TileMap& map = m_room.getMap();
+    Vec2f target(
+        std::clamp(
+            position.x, 0.f,
+            std::max(map.getWidth() * map.getTileSize() - PLAYER_SIZE.x, 0.f)
+        ),
+        std::clamp(
+            position.y, 0.f,
+            std::max(map.getHeight() * map.getTileSize() - PLAYER_SIZE.y, 0.f)
+        )
+    );
+    m_room.slide(collider, target - collider.getPosition());
+    m_bodies.setPosition(client.body, collider.getPosition());
+    return (collider.getPosition());
+}
+
 } // namespace tkd
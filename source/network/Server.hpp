@@ -36,8 +36,14 @@
 #include "utils/Vec2.hpp"
 #include "network/Packet.hpp"
 #include "network/Network.hpp"
+#include "game/Room.hpp"
+#include "game/EntityStore.hpp"
+#include "utils/FixedTimestep.hpp"
+#include "utils/JobSystem.hpp"
 #include <map>
 #include <memory>
+#include <mutex>
+#include <chrono>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -48,6 +54,10 @@ namespace tkd
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
+/// The server runs the same simulation core as the client, Room and
+/// EntityStore, without any rendering. The positions sent by the clients
+/// are swept against the room before being shared with the others.
+///
 ///////////////////////////////////////////////////////////////////////////////
 class Server
 {
@@ -59,7 +69,7 @@ private:
     struct ClientInfo
     {
         Socket socket;          //<!
-        Vec2f position;         //<!
+        EntityStore::Handle body;   //<! The player body in the simulation
     };
 
 private:
@@ -70,15 +80,22 @@ private:
     std::map<int, std::unique_ptr<ClientInfo>> m_clients;   //<!
     Network m_network;                                      //<!
     int m_nextPlayerId;                                     //<!
+    Room m_room;                                            //<! The level
+    EntityStore m_bodies;                                   //<! The bodies
+    FixedTimestep m_timestep;                               //<! The ticks
+    JobSystem m_jobs;                                       //<! The workers
+    std::chrono::steady_clock::time_point m_lastUpdate;     //<! Last tick
+    std::mutex m_mutex;                                     //<! Tick lock
 
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param port
+    /// \param room The room to simulate the players in
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Server(Uint32 port);
+    Server(Uint32 port, const Room& room = Room());
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -94,7 +111,7 @@ public:
     void run(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Step the simulation by the time elapsed since the last call
     ///
     ///////////////////////////////////////////////////////////////////////////
     void update(void);
@@ -129,6 +146,21 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void broadcastPacket(Packet& packet, Socket socket);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move a player body toward a position reported by its client
+    ///
+    /// The body is swept from where the server last saw it, so a client can
+    /// not walk through the solid tiles of the room, and the target is
+    /// clamped to the bounds of the room first. The position must be finite.
+    ///
+    /// \param client The client owning the body
+    /// \param position The position reported by the client
+    ///
+    /// \return The position accepted by the server
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f movePlayer(const ClientInfo& client, const Vec2f& position);
 };
 
 } // namespace tkd
@@ -28,6 +28,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "physics/Collider.hpp"
+#include <algorithm>
+#include <limits>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -52,6 +54,56 @@ bool Collider::operator|(const Collider& other) const
     );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+float Collider::sweep(
+    const Vec2f& motion,
+    const Collider& other,
+    Vec2f& normal
+) const
+{
+    // Boxes left slightly inside a face by rounding still touch it
+    static const float TOLERANCE = 0.001f;
+
+    float enter = -std::numeric_limits<float>::infinity();
+    float exit = std::numeric_limits<float>::infinity();
+    Vec2f face(0.f);
+
+    // Entry and exit times on one axis, false if the boxes never overlap
+    auto axis = [&](float min, float size, float omin, float osize,
+        float speed, const Vec2f& direction)
+    {
+        if (speed == 0.f)
+            return (min < omin + osize && min + size > omin);
+
+        float near = speed > 0.f ? omin - (min + size) : omin + osize - min;
+        float far = speed > 0.f ? omin + osize - min : omin - (min + size);
+        if (near * speed < 0.f && std::abs(near) < TOLERANCE)
+            near = 0.f;
+
+        float start = near / speed;
+        if (start > enter) {
+            enter = start;
+            face = direction * (speed > 0.f ? -1.f : 1.f);
+        }
+        exit = std::min(exit, far / speed);
+        return (true);
+    };
+
+    // The vertical axis goes first so landing on a corner wins the tie
+    if (
+        !axis(m_position.y, m_dimension.y, other.m_position.y,
+            other.m_dimension.y, motion.y, Vec2f(0.f, 1.f)) ||
+        !axis(m_position.x, m_dimension.x, other.m_position.x,
+            other.m_dimension.x, motion.x, Vec2f(1.f, 0.f))
+    ) return (1.f);
+
+    if (enter >= exit || enter < 0.f || enter > 1.f)
+        return (1.f);
+
+    normal = face;
+    return (enter);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Collider::setPosition(const Vec2f& position)
 {
@@ -74,6 +74,26 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     bool operator|(const Collider& other) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find when a moving collider first touches another one
+    ///
+    /// Colliders only touching, or moving along each other, do not hit.
+    /// Colliders already overlapping do not hit either, that case is left to
+    /// the overlap resolution.
+    ///
+    /// \param motion The displacement of this collider during the step
+    /// \param other The static collider
+    /// \param normal Set to the face of other that is hit
+    ///
+    /// \return The time of impact in [0, 1], 1 if there is none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float sweep(
+        const Vec2f& motion,
+        const Collider& other,
+        Vec2f& normal
+    ) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Set the collider position
     ///
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "physics/ColliderBatch.hpp"
+#include <bit>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Bounds of the tested box, as compared against the batch
+///////////////////////////////////////////////////////////////////////////////
+struct BatchBounds
+{
+    float minX;             //<! The left side
+    float minY;             //<! The top side
+    float maxX;             //<! The right side
+    float maxY;             //<! The bottom side
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Arrays of the tested range, offset to its first box
+///////////////////////////////////////////////////////////////////////////////
+struct BatchRange
+{
+    const float* minX;      //<! The left sides
+    const float* minY;      //<! The top sides
+    const float* maxX;      //<! The right sides
+    const float* maxY;      //<! The bottom sides
+    size_t count;           //<! The number of boxes
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static void overlapsScalar(
+    const BatchBounds& box,
+    const BatchRange& range,
+    size_t start,
+    Uint64* mask
+)
+{
+    for (size_t i = start; i < range.count; i++) {
+        bool hit =
+            range.minX[i] < box.maxX && range.maxX[i] > box.minX &&
+            range.minY[i] < box.maxY && range.maxY[i] > box.minY;
+        mask[i / 64] |= static_cast<Uint64>(hit) << (i % 64);
+    }
+}
+
+#if defined(__x86_64__)
+///////////////////////////////////////////////////////////////////////////////
+static size_t overlapsSse(
+    const BatchBounds& box,
+    const BatchRange& range,
+    Uint64* mask
+)
+{
+    const __m128 minX = _mm_set1_ps(box.minX);
+    const __m128 minY = _mm_set1_ps(box.minY);
+    const __m128 maxX = _mm_set1_ps(box.maxX);
+    const __m128 maxY = _mm_set1_ps(box.maxY);
+    size_t i = 0;
+
+    for (; i + 4 <= range.count; i += 4) {
+        __m128 x = _mm_and_ps(
+            _mm_cmplt_ps(_mm_loadu_ps(range.minX + i), maxX),
+            _mm_cmpgt_ps(_mm_loadu_ps(range.maxX + i), minX)
+        );
+        __m128 y = _mm_and_ps(
+            _mm_cmplt_ps(_mm_loadu_ps(range.minY + i), maxY),
+            _mm_cmpgt_ps(_mm_loadu_ps(range.maxY + i), minY)
+        );
+        Uint64 bits = static_cast<Uint64>(_mm_movemask_ps(_mm_and_ps(x, y)));
+        mask[i / 64] |= bits << (i % 64);
+    }
+    return (i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx")))
+static size_t overlapsAvx(
+    const BatchBounds& box,
+    const BatchRange& range,
+    Uint64* mask
+)
+{
+    const __m256 minX = _mm256_set1_ps(box.minX);
+    const __m256 minY = _mm256_set1_ps(box.minY);
+    const __m256 maxX = _mm256_set1_ps(box.maxX);
+    const __m256 maxY = _mm256_set1_ps(box.maxY);
+    size_t i = 0;
+
+    for (; i + 8 <= range.count; i += 8) {
+        __m256 x = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(range.minX + i), maxX, _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(range.maxX + i), minX, _CMP_GT_OQ)
+        );
+        __m256 y = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(range.minY + i), maxY, _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(range.maxY + i), minY, _CMP_GT_OQ)
+        );
+        Uint64 bits = static_cast<Uint64>(
+            _mm256_movemask_ps(_mm256_and_ps(x, y))
+        );
+        mask[i / 64] |= bits << (i % 64);
+    }
+    return (i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool hasAvx(void)
+{
+    static const bool supported = __builtin_cpu_supports("avx");
+    return (supported);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void ColliderBatch::push(const Collider& collider)
+{
+    Vec2f position = collider.getPosition();
+    Vec2f dimension = collider.getDimension();
+
+    m_minX.push_back(position.x);
+    m_minY.push_back(position.y);
+    m_maxX.push_back(position.x + dimension.x);
+    m_maxY.push_back(position.y + dimension.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ColliderBatch::clear(void)
+{
+    m_minX.clear();
+    m_minY.clear();
+    m_maxX.clear();
+    m_maxY.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t ColliderBatch::size(void) const
+{
+    return (m_minX.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Collider ColliderBatch::getCollider(size_t index) const
+{
+    return (Collider(
+        Vec2f(m_minX[index], m_minY[index]),
+        Vec2f(m_maxX[index] - m_minX[index], m_maxY[index] - m_minY[index])
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t ColliderBatch::overlaps(
+    const Collider& bounds,
+    size_t first,
+    size_t count,
+    std::vector<Uint64>& mask
+) const
+{
+    Vec2f position = bounds.getPosition();
+    Vec2f dimension = bounds.getDimension();
+    BatchBounds box = {
+        position.x, position.y,
+        position.x + dimension.x, position.y + dimension.y
+    };
+    BatchRange range = {
+        m_minX.data() + first, m_minY.data() + first,
+        m_maxX.data() + first, m_maxY.data() + first, count
+    };
+    size_t done = 0;
+
+    mask.assign((count + 63) / 64, 0);
+
+#if defined(__x86_64__)
+    if (hasAvx())
+        done = overlapsAvx(box, range, mask.data());
+    else
+        done = overlapsSse(box, range, mask.data());
+#endif
+
+    overlapsScalar(box, range, done, mask.data());
+
+    size_t hits = 0;
+    for (Uint64 word : mask)
+        hits += std::popcount(word);
+    return (hits);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t ColliderBatch::overlaps(
+    const Collider& bounds,
+    std::vector<Uint64>& mask
+) const
+{
+    return (overlaps(bounds, 0, size(), mask));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* ColliderBatch::getBackend(void)
+{
+#if defined(__x86_64__)
+    return (hasAvx() ? "avx" : "sse");
+#else
+    return ("scalar");
+#endif
+}
+
+} // namespace tkd
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "physics/Collider.hpp"
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Packed set of boxes tested against one box at a time
+///
+/// The bounds are stored as four arrays, which lets the overlap test run on
+/// 8 boxes per instruction with AVX or 4 with SSE. The result is a bitmask,
+/// bit i of word i / 64 being set when box i overlaps, with the same rules
+/// as Collider::operator|.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ColliderBatch
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<float> m_minX;  //<! The left side of each box
+    std::vector<float> m_minY;  //<! The top side of each box
+    std::vector<float> m_maxX;  //<! The right side of each box
+    std::vector<float> m_maxY;  //<! The bottom side of each box
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a box at the end of the batch
+    ///
+    /// \param collider The box to add
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void push(const Collider& collider);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every box
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of boxes
+    ///
+    /// \return The number of boxes in the batch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a box of the batch
+    ///
+    /// \param index The index of the box
+    ///
+    /// \return The box as a collider
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Collider getCollider(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Test a box against a range of the batch
+    ///
+    /// \param bounds The box to test
+    /// \param first The index of the first box of the range
+    /// \param count The number of boxes in the range
+    /// \param mask Filled with one bit per box of the range
+    ///
+    /// \return The number of boxes overlapping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t overlaps(
+        const Collider& bounds,
+        size_t first,
+        size_t count,
+        std::vector<Uint64>& mask
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Test a box against the whole batch
+    ///
+    /// \param bounds The box to test
+    /// \param mask Filled with one bit per box of the batch
+    ///
+    /// \return The number of boxes overlapping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t overlaps(const Collider& bounds, std::vector<Uint64>& mask) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the name of the instruction set used on this processor
+    ///
+    /// \return "avx", "sse" or "scalar"
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* getBackend(void);
+};
+
+} // namespace tkd
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "physics/ColliderBenchmark.hpp"
+#include "physics/ColliderBatch.hpp"
+#include "physics/Collider.hpp"
+#include <iomanip>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <limits>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+using Clock = std::chrono::steady_clock;
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of box tests per pass, whatever the set size
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t TESTS_PER_PASS = 1 << 22;
+
+///////////////////////////////////////////////////////////////////////////////
+ColliderBenchmark::ColliderBenchmark(int iterations)
+    : m_iterations(std::max(iterations, 1))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<ColliderBenchmark::Result> ColliderBenchmark::run(void) const
+{
+    std::vector<Result> results;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(0.f, 4096.f);
+    std::uniform_real_distribution<float> dimension(4.f, 64.f);
+
+    for (size_t count : SET_SIZES) {
+        std::vector<Collider> colliders;
+        ColliderBatch batch;
+        for (size_t i = 0; i < count; i++) {
+            colliders.emplace_back(
+                Vec2f(position(random), position(random)),
+                Vec2f(dimension(random), dimension(random))
+            );
+            batch.push(colliders.back());
+        }
+
+        // Boxes the size of a screen, so both tests find some overlaps
+        size_t queries = std::max<size_t>(TESTS_PER_PASS / count, 1);
+        std::vector<Collider> bounds;
+        for (size_t i = 0; i < queries; i++)
+            bounds.emplace_back(
+                Vec2f(position(random), position(random)), Vec2f(800.f, 600.f)
+            );
+
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        Result result{count, 0, infinity, infinity};
+        double tests = static_cast<double>(queries * count);
+        std::vector<Uint64> mask;
+
+        for (int run = 0; run < m_iterations; run++) {
+            size_t scalarHits = 0;
+            auto start = Clock::now();
+            for (const Collider& box : bounds)
+                for (const Collider& collider : colliders)
+                    scalarHits += (collider | box);
+            result.scalar = std::min(result.scalar,
+                std::chrono::duration<double, std::nano>(
+                    Clock::now() - start
+                ).count() / tests
+            );
+
+            size_t batchHits = 0;
+            start = Clock::now();
+            for (const Collider& box : bounds)
+                batchHits += batch.overlaps(box, mask);
+            result.batch = std::min(result.batch,
+                std::chrono::duration<double, std::nano>(
+                    Clock::now() - start
+                ).count() / tests
+            );
+
+            if (scalarHits != batchHits)
+                throw std::runtime_error("Overlap tests disagree");
+            result.hits = scalarHits / queries;
+        }
+        results.push_back(result);
+    }
+    return (results);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ColliderBenchmark::print(
+    std::ostream& os,
+    const std::vector<Result>& results
+)
+{
+    os << "collider overlap (" << ColliderBatch::getBackend() << ")"
+        << std::endl << std::right
+        << std::setw(8) << "boxes" << std::setw(8) << "hits"
+        << std::setw(12) << "scalar ns" << std::setw(12) << "batch ns"
+        << std::setw(10) << "speedup" << std::endl;
+
+    for (const Result& result : results) {
+        os << std::setw(8) << result.count << std::setw(8) << result.hits
+            << std::fixed << std::setprecision(3)
+            << std::setw(12) << result.scalar
+            << std::setw(12) << result.batch
+            << std::setprecision(2)
+            << std::setw(9) << result.scalar / result.batch << "x"
+            << std::endl;
+    }
+    os << std::defaultfloat;
+}
+
+} // namespace tkd
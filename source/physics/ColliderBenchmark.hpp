@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include <vector>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Micro-benchmark of the box overlap tests
+///
+/// Random boxes are tested against sets of growing size, once through
+/// Collider::operator| and once through ColliderBatch, so the gain of the
+/// packed kernel shows for each size class.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ColliderBenchmark
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measures of one set size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Result
+    {
+        size_t count;               //<! The number of boxes in the set
+        size_t hits;                //<! The overlaps found per pass
+        double scalar;              //<! Time per box test in ns, operator|
+        double batch;               //<! Time per box test in ns, batch
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Sizes of the sets measured
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t SET_SIZES[] = {16, 256, 4096, 65536};
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    int m_iterations;               //<! The number of runs kept the best of
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Benchmark constructor
+    ///
+    /// \param iterations The number of runs, the fastest one is reported
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ColliderBenchmark(int iterations = 3);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the benchmark on every set size
+    ///
+    /// \throw std::runtime_error If the two tests disagree
+    ///
+    /// \return The measures, one per set size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Result> run(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Print the measures as a table
+    ///
+    /// \param os The stream to print to
+    /// \param results The measures
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void print(std::ostream& os, const std::vector<Result>& results);
+};
+
+} // namespace tkd
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "physics/Integrator.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Per step values shared by every body
+///////////////////////////////////////////////////////////////////////////////
+struct StepCoefficients
+{
+    float deltaT;           //<! The delta time
+    float gravity;          //<! The velocity gained from gravity
+    float friction;         //<! The horizontal velocity factor
+    float limit;            //<! The maximum speed on each axis
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static void integrateScalar(
+    const Integrator::Bodies& bodies,
+    size_t start,
+    const StepCoefficients& step
+)
+{
+    for (size_t i = start; i < bodies.count; i++) {
+        float vx = std::clamp(bodies.vx[i], -step.limit, step.limit);
+        float vy = bodies.vy[i] + step.gravity * bodies.gravity[i];
+
+        vx *= step.friction;
+        vy = std::clamp(vy, -step.limit, step.limit);
+        bodies.vx[i] = vx;
+        bodies.vy[i] = vy;
+        bodies.x[i] += vx * step.deltaT;
+        bodies.y[i] += vy * step.deltaT;
+    }
+}
+
+#if defined(__x86_64__)
+///////////////////////////////////////////////////////////////////////////////
+static size_t integrateSse(
+    const Integrator::Bodies& bodies,
+    const StepCoefficients& step
+)
+{
+    const __m128 deltaT = _mm_set1_ps(step.deltaT);
+    const __m128 gravity = _mm_set1_ps(step.gravity);
+    const __m128 friction = _mm_set1_ps(step.friction);
+    const __m128 max = _mm_set1_ps(step.limit);
+    const __m128 min = _mm_set1_ps(-step.limit);
+    size_t i = 0;
+
+    for (; i + 4 <= bodies.count; i += 4) {
+        __m128 vx = _mm_loadu_ps(bodies.vx + i);
+        __m128 vy = _mm_loadu_ps(bodies.vy + i);
+        __m128 scale = _mm_loadu_ps(bodies.gravity + i);
+
+        vx = _mm_mul_ps(_mm_min_ps(_mm_max_ps(vx, min), max), friction);
+        vy = _mm_add_ps(vy, _mm_mul_ps(gravity, scale));
+        vy = _mm_min_ps(_mm_max_ps(vy, min), max);
+        _mm_storeu_ps(bodies.vx + i, vx);
+        _mm_storeu_ps(bodies.vy + i, vy);
+
+        __m128 x = _mm_loadu_ps(bodies.x + i);
+        __m128 y = _mm_loadu_ps(bodies.y + i);
+        _mm_storeu_ps(bodies.x + i, _mm_add_ps(x, _mm_mul_ps(vx, deltaT)));
+        _mm_storeu_ps(bodies.y + i, _mm_add_ps(y, _mm_mul_ps(vy, deltaT)));
+    }
+    return (i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx")))
+static size_t integrateAvx(
+    const Integrator::Bodies& bodies,
+    const StepCoefficients& step
+)
+{
+    const __m256 deltaT = _mm256_set1_ps(step.deltaT);
+    const __m256 gravity = _mm256_set1_ps(step.gravity);
+    const __m256 friction = _mm256_set1_ps(step.friction);
+    const __m256 max = _mm256_set1_ps(step.limit);
+    const __m256 min = _mm256_set1_ps(-step.limit);
+    size_t i = 0;
+
+    for (; i + 8 <= bodies.count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(bodies.vx + i);
+        __m256 vy = _mm256_loadu_ps(bodies.vy + i);
+        __m256 scale = _mm256_loadu_ps(bodies.gravity + i);
+
+        vx = _mm256_min_ps(_mm256_max_ps(vx, min), max);
+        vx = _mm256_mul_ps(vx, friction);
+        vy = _mm256_add_ps(vy, _mm256_mul_ps(gravity, scale));
+        vy = _mm256_min_ps(_mm256_max_ps(vy, min), max);
+        _mm256_storeu_ps(bodies.vx + i, vx);
+        _mm256_storeu_ps(bodies.vy + i, vy);
+
+        __m256 x = _mm256_loadu_ps(bodies.x + i);
+        __m256 y = _mm256_loadu_ps(bodies.y + i);
+        x = _mm256_add_ps(x, _mm256_mul_ps(vx, deltaT));
+        y = _mm256_add_ps(y, _mm256_mul_ps(vy, deltaT));
+        _mm256_storeu_ps(bodies.x + i, x);
+        _mm256_storeu_ps(bodies.y + i, y);
+    }
+    return (i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool hasAvx(void)
+{
+    static const bool supported = __builtin_cpu_supports("avx");
+    return (supported);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+Integrator::Integrator(float gravity, float friction, float limit)
+    : m_gravity(gravity)
+    , m_friction(friction)
+    , m_limit(limit)
+    , m_deltaT(0.f)
+    , m_factor(1.f)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void Integrator::integrate(const Bodies& bodies, float deltaT)
+{
+    setDeltaT(deltaT);
+    integrate(bodies);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Integrator::setDeltaT(float deltaT)
+{
+    // With a fixed timestep the factor is computed only once
+    if (deltaT != m_deltaT) {
+        m_deltaT = deltaT;
+        m_factor = std::pow(m_friction, deltaT);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Integrator::integrate(const Bodies& bodies) const
+{
+    StepCoefficients step = {
+        m_deltaT, m_gravity * m_deltaT, m_factor, m_limit
+    };
+    size_t done = 0;
+
+#if defined(__x86_64__)
+    if (hasAvx())
+        done = integrateAvx(bodies, step);
+    else
+        done = integrateSse(bodies, step);
+#endif
+
+    integrateScalar(bodies, done, step);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* Integrator::getBackend(void)
+{
+#if defined(__x86_64__)
+    return (hasAvx() ? "avx" : "sse");
+#else
+    return ("scalar");
+#endif
+}
+
+} // namespace tkd
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Batched integration of body velocities and positions
+///
+/// Bodies are given as separate arrays and processed 8 at a time with AVX or
+/// 4 at a time with SSE when the processor supports it, the remainder and
+/// other architectures going through the scalar loop. Every path gives the
+/// same results as Entity::updatePhysics before collision.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Integrator
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Arrays of the bodies to integrate, all of count elements
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Bodies
+    {
+        float* x;               //<! The horizontal positions
+        float* y;               //<! The vertical positions
+        float* vx;              //<! The horizontal velocities
+        float* vy;              //<! The vertical velocities
+        const float* gravity;   //<! The gravity scales
+        size_t count;           //<! The number of bodies
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    float m_gravity;        //<! The gravity acceleration
+    float m_friction;       //<! The horizontal friction per second
+    float m_limit;          //<! The maximum speed on each axis
+    float m_deltaT;         //<! The delta time of the cached factor
+    float m_factor;         //<! The friction factor for m_deltaT
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default integrator constructor
+    ///
+    /// \param gravity The gravity acceleration
+    /// \param friction The fraction of horizontal velocity kept per second
+    /// \param limit The maximum speed on each axis
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Integrator(float gravity, float friction, float limit);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Apply gravity, friction and the speed limit, then move the
+    /// bodies
+    ///
+    /// The friction factor is computed once per delta time, not per body.
+    ///
+    /// \param bodies The bodies to integrate
+    /// \param deltaT The delta time to apply on calculation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void integrate(const Bodies& bodies, float deltaT);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compute the coefficients of a delta time ahead of integrate
+    ///
+    /// \param deltaT The delta time of the next integrations
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setDeltaT(float deltaT);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Integrate with the delta time given to setDeltaT
+    ///
+    /// Nothing is written to the integrator, so disjoint slices of bodies
+    /// can be integrated from several threads at once.
+    ///
+    /// \param bodies The bodies to integrate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void integrate(const Bodies& bodies) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the name of the instruction set used on this processor
+    ///
+    /// \return "avx", "sse" or "scalar"
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* getBackend(void);
+};
+
+} // namespace tkd
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "physics/SpatialHash.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <bit>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+static Uint64 cellKey(Int32 x, Int32 y)
+{
+    return (
+        (static_cast<Uint64>(static_cast<Uint32>(x)) << 32) |
+        static_cast<Uint32>(y)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::cells(const Collider& bounds, Vec2i& min, Vec2i& max) const
+{
+    Vec2f start = bounds.getPosition() / m_cellSize;
+    Vec2f end = (bounds.getPosition() + bounds.getDimension()) / m_cellSize;
+
+    if (
+        !std::isfinite(start.x) || !std::isfinite(start.y) ||
+        !std::isfinite(end.x) || !std::isfinite(end.y)
+    ) {
+        min = Vec2i(0, 0);
+        max = Vec2i(-1, -1);
+        return;
+    }
+
+    // Clamped while still in float, so a far away box neither overflows the
+    // cast nor spans billions of cells
+    const float limit = static_cast<float>(MAX_CELL);
+    min.x = static_cast<Int32>(std::clamp(std::floor(start.x), -limit, limit));
+    min.y = static_cast<Int32>(std::clamp(std::floor(start.y), -limit, limit));
+    max.x = static_cast<Int32>(std::clamp(std::floor(end.x), -limit, limit));
+    max.y = static_cast<Int32>(std::clamp(std::floor(end.y), -limit, limit));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::link(Uint32 id)
+{
+    const Proxy& proxy = m_proxies[id];
+
+    for (Int32 y = proxy.min.y; y <= proxy.max.y; y++)
+        for (Int32 x = proxy.min.x; x <= proxy.max.x; x++)
+            m_cells[cellKey(x, y)].push_back(id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::unlink(Uint32 id)
+{
+    const Proxy& proxy = m_proxies[id];
+
+    for (Int32 y = proxy.min.y; y <= proxy.max.y; y++) {
+        for (Int32 x = proxy.min.x; x <= proxy.max.x; x++) {
+            auto cell = m_cells.find(cellKey(x, y));
+            if (cell == m_cells.end())
+                continue;
+
+            std::vector<Uint32>& items = cell->second;
+            auto item = std::find(items.begin(), items.end(), id);
+            if (item != items.end()) {
+                *item = items.back();
+                items.pop_back();
+            }
+            if (items.empty())
+                m_cells.erase(cell);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 SpatialHash::insert(const Collider& bounds)
+{
+    Uint32 id;
+    if (!m_free.empty()) {
+        id = m_free.back();
+        m_free.pop_back();
+    } else {
+        id = static_cast<Uint32>(m_proxies.size());
+        m_proxies.push_back(Proxy{bounds, Vec2i(), Vec2i(), false});
+    }
+
+    Proxy& proxy = m_proxies[id];
+    proxy.bounds = bounds;
+    proxy.active = true;
+    cells(bounds, proxy.min, proxy.max);
+    link(id);
+    return (id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::update(Uint32 id, const Collider& bounds)
+{
+    if (id >= m_proxies.size() || !m_proxies[id].active)
+        throw std::out_of_range("Invalid spatial hash id");
+
+    Proxy& proxy = m_proxies[id];
+    proxy.bounds = bounds;
+
+    // Most moves stay in the same cells and leave the hash untouched
+    Vec2i min, max;
+    cells(bounds, min, max);
+    if (min == proxy.min && max == proxy.max)
+        return;
+
+    unlink(id);
+    proxy.min = min;
+    proxy.max = max;
+    link(id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::remove(Uint32 id)
+{
+    if (id >= m_proxies.size() || !m_proxies[id].active)
+        return;
+
+    unlink(id);
+    m_proxies[id].active = false;
+    m_free.push_back(id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::clear(void)
+{
+    m_cells.clear();
+    m_proxies.clear();
+    m_free.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::findPairs(std::vector<Pair>& pairs) const
+{
+    pairs.clear();
+
+    for (const auto& [key, items] : m_cells) {
+        if (items.size() < 2)
+            continue;
+
+        // The boxes of the cell are packed once, then each box is tested
+        // against all the boxes after it in a single batch call
+        m_batch.clear();
+        for (Uint32 id : items)
+            m_batch.push(m_proxies[id].bounds);
+
+        for (size_t i = 0; i + 1 < items.size(); i++) {
+            const Proxy& a = m_proxies[items[i]];
+            size_t count = items.size() - i - 1;
+            if (m_batch.overlaps(a.bounds, i + 1, count, m_mask) == 0)
+                continue;
+
+            for (size_t word = 0; word < m_mask.size(); word++) {
+                for (Uint64 bits = m_mask[word]; bits != 0; bits &= bits - 1) {
+                    size_t j = i + 1 + word * 64 + std::countr_zero(bits);
+                    const Proxy& b = m_proxies[items[j]];
+
+                    // Boxes sharing several cells are reported by the first
+                    // cell they share only
+                    Int32 x = std::max(a.min.x, b.min.x);
+                    Int32 y = std::max(a.min.y, b.min.y);
+                    if (cellKey(x, y) != key)
+                        continue;
+
+                    pairs.emplace_back(
+                        std::min(items[i], items[j]),
+                        std::max(items[i], items[j])
+                    );
+                }
+            }
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpatialHash::query(
+    const Collider& bounds,
+    std::vector<Uint32>& result
+) const
+{
+    result.clear();
+
+    Vec2i min, max;
+    cells(bounds, min, max);
+    for (Int32 y = min.y; y <= max.y; y++) {
+        for (Int32 x = min.x; x <= max.x; x++) {
+            auto cell = m_cells.find(cellKey(x, y));
+            if (cell == m_cells.end())
+                continue;
+            for (Uint32 id : cell->second)
+                if (m_proxies[id].bounds | bounds)
+                    result.push_back(id);
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+} // namespace tkd
@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "utils/Vec2.hpp"
+#include "physics/Collider.hpp"
+#include "physics/ColliderBatch.hpp"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Spatial hash of moving boxes, for finding the overlapping pairs
+///
+/// The space is sparse, only the cells holding a box exist, up to MAX_CELL
+/// cells away from the origin. Moving a box only touches the hash when it
+/// changes cells, so the cost of a tick follows the number of boxes that
+/// cross a cell edge rather than the number of boxes.
+///
+///////////////////////////////////////////////////////////////////////////////
+class SpatialHash
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Custom type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Pair = std::pair<Uint32, Uint32>;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default size of a cell in pixels
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float DEFAULT_CELL_SIZE = 64.f;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Farthest cell from the origin on each axis, boxes beyond are clamped
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Int32 MAX_CELL = 1024;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A box of the hash and the cells it covers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Proxy
+    {
+        Collider bounds;            //<! The box
+        Vec2i min;                  //<! The first cell covered
+        Vec2i max;                  //<! The last cell covered
+        bool active;                //<! Is the proxy in use
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    float m_cellSize;                                       //<! Cell size
+    std::unordered_map<Uint64, std::vector<Uint32>> m_cells;//<! Cell content
+    std::vector<Proxy> m_proxies;                           //<! Boxes by id
+    std::vector<Uint32> m_free;                             //<! Unused ids
+    mutable ColliderBatch m_batch;                          //<! Cell boxes
+    mutable std::vector<Uint64> m_mask;                     //<! Cell hits
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default hash constructor
+    ///
+    /// \param cellSize The size of a cell, about the size of a common box
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the range of cells covered by a box
+    ///
+    /// The range is empty for a box with a non finite coordinate.
+    ///
+    /// \param bounds The box
+    /// \param min The first cell covered
+    /// \param max The last cell covered
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void cells(const Collider& bounds, Vec2i& min, Vec2i& max) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a proxy to the cells of its range
+    ///
+    /// \param id The id of the proxy
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void link(Uint32 id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove a proxy from the cells of its range
+    ///
+    /// \param id The id of the proxy
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void unlink(Uint32 id);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add a box to the hash
+    ///
+    /// \param bounds The box
+    ///
+    /// \return The id of the box, reused once it is removed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 insert(const Collider& bounds);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move a box of the hash
+    ///
+    /// \param id The id of the box
+    /// \param bounds The new box
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(Uint32 id, const Collider& bounds);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove a box from the hash
+    ///
+    /// \param id The id of the box
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void remove(Uint32 id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every box
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find every pair of overlapping boxes
+    ///
+    /// \param pairs Filled with each pair once, the smallest id first, in
+    /// ascending order so the result does not depend on the hash layout
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void findPairs(std::vector<Pair>& pairs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the boxes overlapping a box
+    ///
+    /// \param bounds The box to query
+    /// \param result Filled with the sorted, unique ids
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void query(const Collider& bounds, std::vector<Uint32>& result) const;
+};
+
+} // namespace tkd
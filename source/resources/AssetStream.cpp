@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "resources/AssetStream.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+AssetStream::AssetStream(
+    std::shared_ptr<const UData> blob,
+    Uint64 size,
+    Compressor::Codec codec,
+    bool chunked,
+    std::shared_ptr<const Compressor::Dictionary> dictionary
+)
+    : m_blob(std::move(blob))
+    , m_codec(codec)
+    , m_dictionary(std::move(dictionary))
+    , m_table{0, {}, 0}
+    , m_size(size)
+    , m_position(0)
+    , m_index(0)
+    , m_length(0)
+    , m_chunked(chunked)
+{
+    if (m_chunked)
+        m_table = Compressor::readBlockTable(*m_blob, m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetStream::load(Uint64 position)
+{
+    if (!m_chunked) {
+        if (m_block.empty() && m_size > 0 && m_dictionary)
+            m_block = Compressor::decompress(*m_blob, m_size, *m_dictionary);
+        else if (m_block.empty() && m_size > 0)
+            m_block = Compressor::decompress(*m_blob, m_size, m_codec);
+        m_index = 0;
+        m_length = m_size;
+        return;
+    }
+
+    size_t index = position / m_table.blockSize;
+    if (m_length != 0 && index == m_index)
+        return;
+
+    m_block.resize(m_table.blockSize);
+    m_length = Compressor::decompressBlock(
+        *m_blob, m_table, index, m_size, m_codec, m_block.data()
+    );
+    m_index = index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+sf::Int64 AssetStream::read(void* data, sf::Int64 size)
+{
+    UByte* out = static_cast<UByte*>(data);
+    sf::Int64 count = 0;
+
+    try {
+        while (count < size && m_position < m_size) {
+            load(m_position);
+
+            Uint64 start = m_chunked
+                ? static_cast<Uint64>(m_index) * m_table.blockSize : 0;
+            Uint64 offset = m_position - start;
+            Uint64 length = std::min<Uint64>(
+                m_length - offset, static_cast<Uint64>(size - count)
+            );
+
+            std::memcpy(out + count, m_block.data() + offset, length);
+            m_position += length;
+            count += length;
+        }
+    } catch (const std::exception&) {
+        return (-1);
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+sf::Int64 AssetStream::seek(sf::Int64 position)
+{
+    if (position < 0)
+        return (-1);
+    m_position = std::min<Uint64>(position, m_size);
+    return (m_position);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+sf::Int64 AssetStream::tell(void)
+{
+    return (m_position);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+sf::Int64 AssetStream::getSize(void)
+{
+    return (m_size);
+}
+
+} // namespace tkd
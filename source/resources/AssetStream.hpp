@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "resources/Compressor.hpp"
+#include <SFML/System.hpp>
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Input stream decompressing a packed asset on demand
+///
+/// Chunked blobs are decoded one block at a time, so reading or seeking only
+/// decodes the block under the cursor. Other blobs are a single block.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AssetStream : public sf::InputStream
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<const UData> m_blob;    //<! The compressed blob
+    Compressor::Codec m_codec;              //<! The codec of the blob
+    std::shared_ptr<const Compressor::Dictionary> m_dictionary; //<! Or null
+    Compressor::BlockTable m_table;         //<! The blocks of the blob
+    Uint64 m_size;                          //<! The original size
+    Uint64 m_position;                      //<! The read cursor
+    UData m_block;                          //<! The decoded block
+    size_t m_index;                         //<! The decoded block index
+    size_t m_length;                        //<! The decoded block length
+    bool m_chunked;                         //<! Is the blob chunked
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create a stream over a compressed blob
+    ///
+    /// \param blob The compressed blob, kept alive by the stream
+    /// \param size The original size of the data
+    /// \param codec The codec used to compress the blob
+    /// \param chunked Is the blob made of independent blocks
+    /// \param dictionary The dictionary of the blob, if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AssetStream(
+        std::shared_ptr<const UData> blob,
+        Uint64 size,
+        Compressor::Codec codec,
+        bool chunked,
+        std::shared_ptr<const Compressor::Dictionary> dictionary = nullptr
+    );
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decode the block containing the given position
+    ///
+    /// \param position The position in the original data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void load(Uint64 position);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// \param data The buffer to fill
+    /// \param size The number of bytes to read
+    ///
+    /// \return The number of bytes read, or -1 on error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    sf::Int64 read(void* data, sf::Int64 size) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change the read position, nothing is decoded until next read
+    ///
+    /// \param position The new position
+    ///
+    /// \return The new position, or -1 on error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    sf::Int64 seek(sf::Int64 position) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the read position
+    ///
+    /// \return The current position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    sf::Int64 tell(void) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the original size of the data
+    ///
+    /// \return The size of the stream
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    sf::Int64 getSize(void) override;
+};
+
+} // namespace tkd
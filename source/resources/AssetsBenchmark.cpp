@@ -0,0 +1,387 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "resources/AssetsBenchmark.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <limits>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+using Clock = std::chrono::steady_clock;
+
+///////////////////////////////////////////////////////////////////////////////
+static double elapsed(Clock::time_point start)
+{
+    return (std::chrono::duration<double, std::milli>(
+        Clock::now() - start
+    ).count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static const AssetsPacker::AssetType BENCHMARK_TYPES[] = {
+    AssetsPacker::AssetType::Image,
+    AssetsPacker::AssetType::Sound,
+    AssetsPacker::AssetType::Data
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static const Compressor::Codec BENCHMARK_CODECS[] = {
+    Compressor::Codec::Stored,
+    Compressor::Codec::Zlib,
+    Compressor::Codec::LZ4,
+    Compressor::Codec::Zstd
+};
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsBenchmark::AssetsBenchmark(
+    const Path& directory,
+    size_t scale,
+    int iterations
+)
+    : m_directory(directory)
+    , m_scale(std::max<size_t>(scale, 1))
+    , m_iterations(std::max(iterations, 1))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsBenchmark::Path AssetsBenchmark::corpus(AssetType type) const
+{
+    return (
+        m_directory / ("corpus-x" + std::to_string(m_scale)) / getName(type)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsBenchmark::generate(void) const
+{
+    // An empty file sorted between two others, so the round trip covers an
+    // empty blob packed next to a real one; corpora generated before it get
+    // it too
+    std::filesystem::create_directories(corpus(AssetType::Data));
+    std::ofstream(corpus(AssetType::Data) / "0000-empty.dat");
+
+    Path stamp = corpus(AssetType::Data).parent_path() / ".complete";
+    if (std::filesystem::exists(stamp))
+        return;
+
+    std::mt19937 random(42);
+    auto name = [](size_t index, const char* extension){
+        std::ostringstream oss;
+        oss << std::setw(4) << std::setfill('0') << index << extension;
+        return (oss.str());
+    };
+
+    // Sprites: a few opaque shapes over a transparent background, which is
+    // what most of the game images look like
+    std::filesystem::create_directories(corpus(AssetType::Image));
+    for (size_t i = 0; i < IMAGES_PER_SCALE * m_scale; i++) {
+        unsigned size = 64u << (i % 3);
+        sf::Image image;
+        image.create(size, size, sf::Color::Transparent);
+        for (int shape = 0; shape < 6; shape++) {
+            unsigned x = random() % size, y = random() % size;
+            unsigned w = random() % (size / 2) + 1, h = random() % (size / 2);
+            sf::Color color(random() % 256, random() % 256, random() % 256);
+            for (unsigned py = y; py < std::min(size, y + h); py++)
+                for (unsigned px = x; px < std::min(size, x + w); px++)
+                    image.setPixel(px, py, color);
+        }
+        Path filepath = corpus(AssetType::Image) / name(i, ".png");
+        if (!image.saveToFile(filepath.string()))
+            throw std::runtime_error("Cannot write: " + filepath.string());
+    }
+
+    // Sounds: one second of a tone with some noise
+    std::filesystem::create_directories(corpus(AssetType::Sound));
+    const unsigned sampleRate = 22050;
+    std::vector<Int16> samples(sampleRate);
+    for (size_t i = 0; i < SOUNDS_PER_SCALE * m_scale; i++) {
+        double frequency = 220.0 * (1 + i % 4);
+        for (size_t s = 0; s < samples.size(); s++) {
+            double tone = std::sin(2 * M_PI * frequency * s / sampleRate);
+            samples[s] = static_cast<Int16>(
+                tone * 8000 + static_cast<int>(random() % 2000) - 1000
+            );
+        }
+        sf::SoundBuffer buffer;
+        Path filepath = corpus(AssetType::Sound) / name(i, ".wav");
+        if (
+            !buffer.loadFromSamples(
+                samples.data(), samples.size(), 1, sampleRate
+            ) || !buffer.saveToFile(filepath.string())
+        ) throw std::runtime_error("Cannot write: " + filepath.string());
+    }
+
+    // Data: JSON like records, with every sixteenth file above the chunking
+    // threshold so the streamed path is measured too
+    std::filesystem::create_directories(corpus(AssetType::Data));
+    const char* words[] = {"neon", "abyss", "room", "player", "enemy", "door"};
+    for (size_t i = 0; i < DATA_PER_SCALE * m_scale; i++) {
+        size_t target = i % 16 == 15
+            ? AssetsPacker::CHUNK_THRESHOLD * 2 : 16 * 1024 << (i % 3);
+        std::ostringstream oss;
+        for (size_t id = 0; static_cast<size_t>(oss.tellp()) < target; id++) {
+            oss << "{\"id\": " << id << ", \"name\": \""
+                << words[random() % 6] << "\", \"x\": "
+                << random() % 4096 << ", \"y\": " << random() % 4096
+                << "}\n";
+        }
+        Path filepath = corpus(AssetType::Data) / name(i, ".dat");
+        std::ofstream file(filepath, std::ios::binary);
+        file << oss.str();
+        if (!file)
+            throw std::runtime_error("Cannot write: " + filepath.string());
+    }
+
+    std::ofstream(stamp) << m_scale << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsBenchmark::Result AssetsBenchmark::measure(
+    const std::string& filename,
+    AssetType type
+) const
+{
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    Result result{
+        Compressor::Codec::Stored, type, 0, 0, 0,
+        infinity, infinity, infinity, 0.0
+    };
+
+    // Every run starts from a fresh packer, so the first access really
+    // decodes, and the best run is kept to hide scheduling noise
+    for (int run = 0; run < m_iterations; run++) {
+        AssetsPacker packer(
+            Z_DEFAULT_COMPRESSION, std::numeric_limits<size_t>::max()
+        );
+
+        auto start = Clock::now();
+        packer.unpack(filename);
+        result.open = std::min(result.open, elapsed(start));
+
+        std::vector<std::string> keys;
+        for (const auto& [key, asset] : packer.getAssets())
+            keys.push_back(key);
+        std::sort(keys.begin(), keys.end());
+        if (keys.empty())
+            throw std::runtime_error("Empty pack: " + filename);
+
+        auto access = [&packer, type](const std::string& key){
+            bool found = false;
+            if (type == AssetType::Image)
+                found = packer.getImage(key).has_value();
+            else if (type == AssetType::Sound)
+                found = packer.getSound(key).has_value();
+            else if (type == AssetType::Font)
+                found = packer.getFont(key).has_value();
+            else
+                found = packer.getData(key).has_value();
+            if (!found)
+                throw std::runtime_error("Cannot decode: " + key);
+        };
+
+        start = Clock::now();
+        for (const std::string& key : keys)
+            access(key);
+        result.first = std::min(
+            result.first, elapsed(start) * 1000.0 / keys.size()
+        );
+
+        start = Clock::now();
+        for (const std::string& key : keys)
+            access(key);
+        result.cached = std::min(
+            result.cached, elapsed(start) * 1000.0 / keys.size()
+        );
+
+        // The decompression alone, through the streams the game uses
+        UData buffer(64 * 1024);
+        size_t total = 0;
+        start = Clock::now();
+        for (const std::string& key : keys) {
+            auto stream = packer.openStream(key);
+            if (!stream)
+                throw std::runtime_error("Unreadable asset: " + key);
+            Int64 count = 0;
+            while ((count = stream->read(buffer.data(), buffer.size())) > 0)
+                total += static_cast<size_t>(count);
+        }
+        double seconds = elapsed(start) / 1000.0;
+        double speed = total / (1024.0 * 1024.0) / std::max(seconds, 1e-9);
+        result.throughput = std::max(result.throughput, speed);
+        result.count = keys.size();
+    }
+
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsBenchmark::check(const std::string& filename, AssetType type) const
+{
+    if (type != AssetType::Data)
+        return;
+
+    AssetsPacker packer;
+    packer.unpack(filename);
+    for (const auto& [key, asset] : packer.getAssets()) {
+        std::ifstream file(corpus(type) / key, std::ios::binary);
+        UData source{
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()
+        };
+        auto data = packer.getData(key);
+        if (!file.is_open() || !data || **data != source)
+            throw std::runtime_error("Round trip mismatch: " + key);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<AssetsBenchmark::Result> AssetsBenchmark::run(void) const
+{
+    generate();
+
+    std::vector<Result> results;
+    for (Compressor::Codec codec : BENCHMARK_CODECS) {
+        for (AssetType type : BENCHMARK_TYPES) {
+            AssetsPacker packer;
+            AssetsPacker::Encoding encoding = packer.getEncoding();
+            encoding.codec = codec;
+            encoding.level = Compressor::defaultLevel(codec);
+            packer.setEncoding(encoding);
+            packer.addDirectory(corpus(type));
+
+            Path filename = m_directory /
+                (Compressor::getName(codec) + '-' + getName(type) + ".pak");
+            packer.pack(filename.string());
+            check(filename.string(), type);
+
+            Result result = measure(filename.string(), type);
+            result.codec = codec;
+            result.packed = std::filesystem::file_size(filename);
+            for (const auto& [key, asset] : packer.getAssets())
+                result.size += asset.size;
+            results.push_back(result);
+        }
+    }
+    return (results);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsBenchmark::print(
+    std::ostream& os,
+    const std::vector<Result>& results
+)
+{
+    os << std::left
+        << std::setw(8) << "codec" << std::setw(7) << "type"
+        << std::right
+        << std::setw(6) << "count" << std::setw(13) << "size"
+        << std::setw(13) << "packed" << std::setw(7) << "ratio"
+        << std::setw(10) << "open ms" << std::setw(11) << "first us"
+        << std::setw(11) << "cached us" << std::setw(10) << "Mo/s"
+        << std::endl;
+
+    for (const Result& result : results) {
+        double ratio = result.size == 0
+            ? 0.0 : static_cast<double>(result.packed) / result.size;
+        os << std::left
+            << std::setw(8) << Compressor::getName(result.codec)
+            << std::setw(7) << getName(result.type)
+            << std::right << std::fixed
+            << std::setw(6) << result.count
+            << std::setw(13) << AssetsPacker::formatSize(result.size)
+            << std::setw(13) << AssetsPacker::formatSize(result.packed)
+            << std::setprecision(3) << std::setw(7) << ratio
+            << std::setprecision(2) << std::setw(10) << result.open
+            << std::setw(11) << result.first
+            << std::setw(11) << result.cached
+            << std::setprecision(1) << std::setw(10) << result.throughput
+            << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsBenchmark::save(
+    const std::string& filename,
+    const std::string& build,
+    const std::vector<Result>& results
+)
+{
+    std::ofstream out(filename);
+    if (!out)
+        throw std::runtime_error("Cannot open file: " + filename);
+
+    out << "{\n  \"build\": \"" << build << "\",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << std::fixed << std::setprecision(3)
+            << "    {\"codec\": \"" << Compressor::getName(result.codec)
+            << "\", \"type\": \"" << getName(result.type)
+            << "\", \"count\": " << result.count
+            << ", \"size\": " << result.size
+            << ", \"packed\": " << result.packed
+            << ", \"open_ms\": " << result.open
+            << ", \"first_access_us\": " << result.first
+            << ", \"cached_access_us\": " << result.cached
+            << ", \"throughput_mo_s\": " << result.throughput << "}";
+    }
+    out << "\n  ]\n}\n";
+
+    if (!out)
+        throw std::runtime_error("Cannot write file: " + filename);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string AssetsBenchmark::getName(AssetType type)
+{
+    switch (type) {
+        case AssetType::Image:  return ("image");
+        case AssetType::Sound:  return ("sound");
+        case AssetType::Font:   return ("font");
+        case AssetType::Data:   return ("data");
+        case AssetType::Unknown: break;
+    }
+    return ("unknown");
+}
+
+} // namespace tkd
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include "resources/AssetsPacker.hpp"
+#include "resources/Compressor.hpp"
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Benchmark of the assets packer on a synthetic corpus
+///
+/// The corpus is generated once in a work directory, then packed with every
+/// codec, one pack per asset type, so a change in one codec or one decoder
+/// shows up on its own row. Fonts cannot be synthesized and are left out.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AssetsBenchmark
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Custom type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Path = std::filesystem::path;
+    using AssetType = AssetsPacker::AssetType;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measures of one codec on one asset type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Result
+    {
+        Compressor::Codec codec;    //<! The codec the pack was built with
+        AssetType type;             //<! The asset type measured
+        size_t count;               //<! The number of assets
+        size_t size;                //<! The size of the source files
+        size_t packed;              //<! The size of the pack file
+        double open;                //<! Time to unpack the file in ms
+        double first;               //<! Mean first access latency in us
+        double cached;              //<! Mean cached access latency in us
+        double throughput;          //<! Full decompression speed in Mo/s
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of files of each type generated per unit of scale
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t IMAGES_PER_SCALE = 32;
+    static constexpr size_t SOUNDS_PER_SCALE = 8;
+    static constexpr size_t DATA_PER_SCALE = 32;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    Path m_directory;               //<! The work directory
+    size_t m_scale;                 //<! The corpus size multiplier
+    int m_iterations;               //<! The number of runs kept the best of
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Benchmark constructor
+    ///
+    /// \param directory The work directory for the corpus and the packs
+    /// \param scale The corpus size multiplier
+    /// \param iterations The number of runs, the fastest one is reported
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AssetsBenchmark(
+        const Path& directory,
+        size_t scale = 1,
+        int iterations = 3
+    );
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Generate the synthetic corpus if it does not exist yet
+    ///
+    /// The content is seeded, so every run measures the same bytes.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void generate(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measure one pack file for one asset type
+    ///
+    /// \param filename The pack file
+    /// \param type The asset type
+    ///
+    /// \return The measures, codec and sizes are left to the caller
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Result measure(const std::string& filename, AssetType type) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check that the data assets of a pack match their source files
+    ///
+    /// \param filename The pack file
+    /// \param type The asset type, only data assets are compared
+    ///
+    /// \throw std::runtime_error if an asset differs from its file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void check(const std::string& filename, AssetType type) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the corpus directory of an asset type
+    ///
+    /// \param type The asset type
+    ///
+    /// \return The directory holding the files of that type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Path corpus(AssetType type) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the benchmark for every codec and every asset type
+    ///
+    /// \return One result per codec and asset type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Result> run(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Print the results as a table
+    ///
+    /// \param os The output stream
+    /// \param results The results to print
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void print(std::ostream& os, const std::vector<Result>& results);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Save the results as JSON
+    ///
+    /// \param filename The output file
+    /// \param build The commit or build the results were measured on
+    /// \param results The results to save
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void save(
+        const std::string& filename,
+        const std::string& build,
+        const std::vector<Result>& results
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the name of an asset type
+    ///
+    /// \param type The asset type
+    ///
+    /// \return The lowercase name of the type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string getName(AssetType type);
+};
+
+} // namespace tkd
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "resources/AssetsCache.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsCache::AssetsCache(size_t budget)
+    : m_budget(budget)
+    , m_size(0)
+    , m_hits(0)
+    , m_misses(0)
+    , m_evictions(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsCache::evict(void)
+{
+    while (m_size > m_budget && !m_order.empty()) {
+        auto it = m_entries.find(m_order.back());
+        m_size -= it->second.cost;
+        m_entries.erase(it);
+        m_order.pop_back();
+        m_evictions++;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsCache::insert(const std::string& key, Asset asset, size_t cost)
+{
+    erase(key);
+    if (cost > m_budget)
+        return;
+
+    m_order.push_front(key);
+    m_entries[key] = Entry{std::move(asset), cost, m_order.begin()};
+    m_size += cost;
+    evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsCache::erase(const std::string& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+    m_size -= it->second.cost;
+    m_order.erase(it->second.order);
+    m_entries.erase(it);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsCache::clear(void)
+{
+    m_entries.clear();
+    m_order.clear();
+    m_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsCache::setBudget(size_t budget)
+{
+    m_budget = budget;
+    evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsCache::Stats AssetsCache::getStats(void) const
+{
+    return (Stats{
+        m_hits,
+        m_misses,
+        m_evictions,
+        m_size,
+        m_budget,
+        m_entries.size()
+    });
+}
+
+} // namespace tkd
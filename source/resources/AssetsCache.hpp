@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <memory>
+#include <list>
+#include <unordered_map>
+#include <variant>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded LRU cache of decoded assets
+///
+/// Decoded assets are handed out as shared pointers, so evicting an entry
+/// only drops the cache reference: callers keep their copy alive.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AssetsCache
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Custom type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using Asset = std::variant<
+        std::shared_ptr<sf::Image>,
+        std::shared_ptr<sf::SoundBuffer>,
+        std::shared_ptr<sf::Font>,
+        std::shared_ptr<UData>
+    >;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Cache usage counters
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Stats
+    {
+        Uint64 hits;            //<! Number of lookups served by the cache
+        Uint64 misses;          //<! Number of lookups that had to decode
+        Uint64 evictions;       //<! Number of entries dropped by the budget
+        size_t size;            //<! Estimated memory used by the entries
+        size_t budget;          //<! Maximum memory allowed for the entries
+        size_t count;           //<! Number of entries in the cache
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default memory budget of the cache (64 Mo)
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t DEFAULT_BUDGET = 64 * 1024 * 1024;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Cached asset with its bookkeeping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Asset asset;                                //<! The decoded asset
+        size_t cost;                                //<! The estimated size
+        std::list<std::string>::iterator order;     //<! Position in the LRU
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::unordered_map<std::string, Entry> m_entries;   //<! Entries by key
+    std::list<std::string> m_order;     //<! Keys, most recently used first
+    size_t m_budget;                    //<! The memory budget
+    size_t m_size;                      //<! The memory currently used
+    Uint64 m_hits;                      //<! The hit counter
+    Uint64 m_misses;                    //<! The miss counter
+    Uint64 m_evictions;                 //<! The eviction counter
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default cache constructor
+    ///
+    /// \param budget The memory budget of the cache in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AssetsCache(size_t budget = DEFAULT_BUDGET);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the least recently used entries until the budget is met
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void evict(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lookup a decoded asset and mark it as recently used
+    ///
+    /// \tparam T The decoded asset type
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The cached asset, or nullptr on a miss
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    std::shared_ptr<T> get(const std::string& key)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            m_misses++;
+            return (nullptr);
+        }
+
+        auto asset = std::get_if<std::shared_ptr<T>>(&it->second.asset);
+        if (!asset) {
+            m_misses++;
+            return (nullptr);
+        }
+
+        m_order.splice(m_order.begin(), m_order, it->second.order);
+        m_hits++;
+        return (*asset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insert a decoded asset, replacing any previous entry
+    ///
+    /// Assets bigger than the whole budget are not cached.
+    ///
+    /// \param key The asset key
+    /// \param asset The decoded asset
+    /// \param cost The estimated memory used by the asset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(const std::string& key, Asset asset, size_t cost);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove an asset from the cache
+    ///
+    /// \param key The asset key
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void erase(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every asset from the cache, counters are kept
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change the memory budget, evicting entries if needed
+    ///
+    /// \param budget The new memory budget in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setBudget(size_t budget);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the cache counters
+    ///
+    /// \return The current statistics of the cache
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Stats getStats(void) const;
+};
+
+} // namespace tkd
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "resources/AssetsLoader.hpp"
+#include <algorithm>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+const sf::Time AssetsLoader::DEFAULT_BUDGET = sf::milliseconds(2);
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of texture rows uploaded between two budget checks
+///////////////////////////////////////////////////////////////////////////////
+static const unsigned UPLOAD_ROWS = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::AssetsLoader(AssetsPacker& packer, size_t threads)
+    : m_packer(packer)
+    , m_pending(0)
+    , m_pool(threads ? threads : std::max(
+        2u, std::thread::hardware_concurrency()
+    ) - 1)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::Future<sf::Image> AssetsLoader::loadImage(
+    const std::string& key
+)
+{
+    return (load<sf::Image>(key, &AssetsPacker::getImage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::Future<sf::SoundBuffer> AssetsLoader::loadSound(
+    const std::string& key
+)
+{
+    return (load<sf::SoundBuffer>(key, &AssetsPacker::getSound));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::Future<sf::Font> AssetsLoader::loadFont(const std::string& key)
+{
+    return (load<sf::Font>(key, &AssetsPacker::getFont));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::Future<UData> AssetsLoader::loadData(const std::string& key)
+{
+    return (load<UData>(key, &AssetsPacker::getData));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::TextureHandle AssetsLoader::loadTexture(const std::string& key)
+{
+    if (auto existing = m_textures[key].lock())
+        return (existing);
+
+    auto request = std::make_shared<TextureRequest>();
+    m_textures[key] = request;
+    m_pending++;
+
+    AssetsPacker& packer = m_packer;
+    m_pool.submit([this, &packer, key, request](void){
+        auto image = packer.getImage(key);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_uploads.push_back({request, image ? *image : nullptr, 0});
+    });
+
+    return (request);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsLoader::SpriteHandle AssetsLoader::loadSprite(const std::string& key)
+{
+    auto region = m_packer.getRegion(key);
+    if (!region)
+        return (SpriteHandle{nullptr, sf::IntRect()});
+    return (SpriteHandle{loadTexture(region->page), region->rect});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsLoader::update(sf::Time budget)
+{
+    sf::Clock clock;
+
+    do {
+        Upload upload;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_uploads.empty())
+                return;
+            upload = m_uploads.front();
+        }
+
+        TextureRequest& request = *upload.request;
+        bool done = true;
+
+        if (!upload.image) {
+            request.status = TextureRequest::Status::Failed;
+        } else {
+            sf::Vector2u size = upload.image->getSize();
+
+            if (!request.texture) {
+                request.texture = std::make_shared<sf::Texture>();
+                if (!request.texture->create(size.x, size.y)) {
+                    request.texture.reset();
+                    request.status = TextureRequest::Status::Failed;
+                }
+            }
+
+            if (request.texture) {
+                unsigned rows = std::min(UPLOAD_ROWS, size.y - upload.row);
+
+                request.texture->update(
+                    upload.image->getPixelsPtr() + size.x * upload.row * 4,
+                    size.x, rows, 0, upload.row
+                );
+                upload.row += rows;
+                done = upload.row >= size.y;
+                if (done)
+                    request.status = TextureRequest::Status::Ready;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (done) {
+            m_uploads.pop_front();
+            m_pending--;
+        } else {
+            m_uploads.front().row = upload.row;
+        }
+    } while (clock.getElapsedTime() < budget);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AssetsLoader::idle(void) const
+{
+    return (m_pending == 0);
+}
+
+} // namespace tkd
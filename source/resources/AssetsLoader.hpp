@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "resources/AssetsPacker.hpp"
+#include "utils/ThreadPool.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Background loader built on top of an assets packer
+///
+/// Decompression and decoding run on worker threads. Textures need the
+/// OpenGL context of the main thread, so their upload is queued and done
+/// by `update`, a few rows at a time, within a per-frame time budget.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AssetsLoader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Custom type alias
+    ///////////////////////////////////////////////////////////////////////////
+    using TexturePtr = std::shared_ptr<sf::Texture>;
+
+    template <typename T>
+    using Future = std::shared_future<std::shared_ptr<T>>;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief State of a texture request, only touched by the main thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct TextureRequest
+    {
+        enum class Status
+        {
+            Loading,
+            Ready,
+            Failed
+        };
+
+        Status status = Status::Loading;    //<! The request status
+        TexturePtr texture;                 //<! The texture once ready
+    };
+
+    using TextureHandle = std::shared_ptr<const TextureRequest>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Texture and area to draw an image from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct SpriteHandle
+    {
+        TextureHandle texture;              //<! The page texture
+        sf::IntRect rect;                   //<! The image in the page
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default upload budget per frame
+    ///////////////////////////////////////////////////////////////////////////
+    static const sf::Time DEFAULT_BUDGET;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decoded image waiting for its upload
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Upload
+    {
+        std::shared_ptr<TextureRequest> request;    //<! The request
+        AssetsPacker::ImagePtr image;               //<! The decoded image
+        unsigned row;                               //<! The next row
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    AssetsPacker& m_packer;                     //<! The assets source
+    std::mutex m_mutex;                         //<! The upload queue mutex
+    std::deque<Upload> m_uploads;               //<! The decoded images
+    std::unordered_map<
+        std::string,
+        std::weak_ptr<TextureRequest>
+    > m_textures;                               //<! Requests by key
+    size_t m_pending;                           //<! Requests not uploaded
+    ThreadPool m_pool;                          //<! The worker threads
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create a loader
+    ///
+    /// \param packer The packer to load the assets from
+    /// \param threads The number of workers, 0 to keep one core free
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AssetsLoader(AssetsPacker& packer, size_t threads = 0);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run a packer getter on a worker thread
+    ///
+    /// \tparam T The decoded asset type
+    /// \tparam Getter The packer getter type
+    ///
+    /// \param key The asset key
+    /// \param getter The packer getter
+    ///
+    /// \return The future decoded asset, nullptr if it cannot be loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Getter>
+    Future<T> load(const std::string& key, Getter getter)
+    {
+        AssetsPacker& packer = m_packer;
+
+        return (m_pool.submit([&packer, key, getter](void){
+            auto asset = (packer.*getter)(key);
+            return (asset ? *asset : std::shared_ptr<T>());
+        }).share());
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress and decode an image in the background
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The future image, nullptr if it cannot be loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Future<sf::Image> loadImage(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress and decode a sound in the background
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The future sound buffer, nullptr if it cannot be loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Future<sf::SoundBuffer> loadSound(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress and decode a font in the background
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The future font, nullptr if it cannot be loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Future<sf::Font> loadFont(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress raw data in the background
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The future data, nullptr if it cannot be loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Future<UData> loadData(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decode an image in the background and upload it as a texture
+    ///
+    /// Requesting a texture that is still alive returns the same handle.
+    ///
+    /// \param key The asset key
+    ///
+    /// \return The handle to poll for the texture
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TextureHandle loadTexture(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load the texture to draw an image from
+    ///
+    /// Atlased images share the texture of their page, so sprites drawn from
+    /// the same page can be batched together.
+    ///
+    /// \param key The image key
+    ///
+    /// \return The page texture and the image area, or an empty handle if
+    /// the key is not an image
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteHandle loadSprite(const std::string& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Upload the decoded textures, must be called on the main thread
+    ///
+    /// At least one band of rows is uploaded per call so the queue always
+    /// progresses, even with a null budget.
+    ///
+    /// \param budget The maximum time to spend uploading
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(sf::Time budget = DEFAULT_BUDGET);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if every texture request has been processed
+    ///
+    /// \return True if no texture is waiting to be decoded or uploaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool idle(void) const;
+};
+
+} // namespace tkd
@@ -29,6 +29,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "resources/AssetsPacker.hpp"
 #include "resources/Compressor.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/Hash.hpp"
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imgui/imstb_rectpack.h"
 #include <fstream>
 #include <sstream>
 #include <limits>
@@ -36,6 +41,13 @@
 #include <filesystem>
 #include <stdexcept>
 #include <memory>
+#include <algorithm>
+#include <future>
+#include <tuple>
+#include <chrono>
+#include <map>
+#include <set>
+#include <unordered_set>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -49,10 +61,20 @@ namespace tkd
 
 ///////////////////////////////////////////////////////////////////////////////
 const char* AssetsPacker::ASSETS_SIGNATURE = "TKDASSETS";
+const char* AssetsPacker::ASSETS_SIGNATURE_V2 = "TKDASSET2";
+const char* AssetsPacker::ATLAS_PREFIX = "@atlas/";
 
 ///////////////////////////////////////////////////////////////////////////////
-AssetsPacker::AssetsPacker(int level)
-    : m_level(level)
+AssetsPacker::AssetsPacker(int level, size_t cacheBudget)
+    : m_cache(cacheBudget)
+    , m_encoding{
+        Compressor::Codec::Zlib,
+        level,
+        false,
+        Compressor::DEFAULT_DECODE_BUDGET,
+        false
+    }
+    , m_verification(Verification::None)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -60,9 +82,100 @@ AssetsPacker& AssetsPacker::operator<<(
     const std::pair<std::string, Path>& entry
 )
 {
-    const std::string& key = entry.first;
-    const Path& filepath = entry.second;
+    addAssets({entry}, 1);
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::CompressedAsset AssetsPacker::compressAsset(
+    const UData& raw,
+    AssetType type,
+    const Encoding& encoding
+)
+{
+    CompressedAsset asset{
+        nullptr, raw.size(), type, encoding.codec, 0, 0, 0, 0, 0, nullptr,
+        {}, {}
+    };
+
+    using Clock = std::chrono::steady_clock;
+    auto micros = [](Clock::time_point start){
+        return (static_cast<Uint32>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start
+            ).count()
+        ));
+    };
+
+    // The image size is decoded from the bytes already in memory instead of
+    // opening the file a second time
+    sf::Image img;
+    if (type == AssetType::Image) {
+        auto start = Clock::now();
+        if (img.loadFromMemory(raw.data(), raw.size())) {
+            asset.image.sourceTime = micros(start);
+            asset.image.width = img.getSize().x;
+            asset.image.height = img.getSize().y;
+        }
+    }
+
+    // Raw images are stored as their RGBA pixels wrapped in LZ4, loading
+    // them is a fast inflate and a copy instead of running the image codec
+    if (encoding.rawImages && asset.image.width != 0) {
+        Uint32 sourceTime = asset.image.sourceTime;
+        asset = compressPixels(img);
+        asset.image.sourceTime = sourceTime;
+        return (asset);
+    }
+
+    asset.data = std::make_shared<const UData>(encoding.automatic
+        ? Compressor::compressAuto(raw, encoding.budget, asset.codec)
+        : Compressor::compress(raw, asset.codec, encoding.level)
+    );
+
+    return (asset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::CompressedAsset AssetsPacker::compressPixels(
+    const sf::Image& image
+)
+{
+    using Clock = std::chrono::steady_clock;
+    sf::Vector2u size = image.getSize();
+    const Uint8* pixels = image.getPixelsPtr();
+    UData data(pixels, pixels + static_cast<size_t>(size.x) * size.y * 4);
+
+    CompressedAsset asset{
+        nullptr, data.size(), AssetType::Image, Compressor::Codec::LZ4,
+        AssetFlag::Raw, Hash::fnv1a(data.data(), data.size()), 0, 0, 0,
+        nullptr, {}, {}
+    };
+    asset.image.width = size.x;
+    asset.image.height = size.y;
+    asset.data = std::make_shared<const UData>(Compressor::compress(
+        data, asset.codec, Compressor::defaultLevel(asset.codec)
+    ));
 
+    // The load time of the raw path is measured for the pack report
+    auto start = Clock::now();
+    sf::Image decoded;
+    UData copy = Compressor::decompress(*asset.data, asset.size, asset.codec);
+    decoded.create(size.x, size.y, copy.data());
+    asset.image.rawTime = static_cast<Uint32>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - start
+        ).count()
+    );
+    return (asset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::CompressedAsset AssetsPacker::loadAsset(
+    const Path& filepath,
+    const Encoding& encoding
+)
+{
     AssetType type = detectAssetType(filepath);
     if (type == AssetType::Unknown)
         throw std::runtime_error("Unknown asset type: " + filepath.string());
@@ -71,28 +184,523 @@ AssetsPacker& AssetsPacker::operator<<(
     if (!file)
         throw std::runtime_error("Cannot open file: " + filepath.string());
 
-    auto raw = UData(std::istreambuf_iterator<char>(file), {});
-    auto data = Compressor::compress(raw);
+    Uint64 size = std::filesystem::file_size(filepath);
+    CompressedAsset asset;
 
-    CompressedAsset asset{data, raw.size(), type, {}};
+    if (
+        size >= CHUNK_THRESHOLD &&
+        (type == AssetType::Sound || type == AssetType::Data)
+    ) {
+        // Large sounds and data are compressed block by block, straight
+        // from the file, so they can be streamed back the same way
+        asset = {
+            nullptr, size, type, encoding.codec, AssetFlag::Chunked,
+            0, 0, 0, 0, nullptr, {}, {}
+        };
 
-    if (type == AssetType::Image) {
-        sf::Image img;
-        if (img.loadFromFile(filepath.string())) {
-            asset.image.width = img.getSize().x;
-            asset.image.height = img.getSize().y;
+        int level = encoding.level;
+        if (encoding.automatic) {
+            UData sample(
+                std::min<Uint64>(size, Compressor::DEFAULT_BLOCK_SIZE)
+            );
+            file.read(reinterpret_cast<char*>(sample.data()), sample.size());
+            file.seekg(0);
+            Compressor::compressAuto(sample, encoding.budget, asset.codec);
+            level = Compressor::defaultLevel(asset.codec);
         }
-    } else if (type == AssetType::Sound) {
-        sf::SoundBuffer buffer;
-        if (buffer.loadFromFile(filepath.string())) {
-            asset.audio.channelCount = buffer.getChannelCount();
-            asset.audio.sampleRate = buffer.getSampleRate();
-            asset.audio.sampleCount = buffer.getSampleCount();
+
+        asset.data = std::make_shared<const UData>(
+            Compressor::compressChunked(file, size, asset.codec, level)
+        );
+    } else {
+        asset = compressAsset(
+            UData(std::istreambuf_iterator<char>(file), {}), type, encoding
+        );
+    }
+
+    // Only the header of the sound file is read to get its properties
+    if (type == AssetType::Sound) {
+        sf::InputSoundFile sound;
+        if (sound.openFromFile(filepath.string())) {
+            asset.audio.channelCount = sound.getChannelCount();
+            asset.audio.sampleRate = sound.getSampleRate();
+            asset.audio.sampleCount = sound.getSampleCount();
         }
     }
 
-    m_assets[key] = std::move(asset);
-    return (*this);
+    return (asset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AssetsPacker::sameContents(const Path& first, const Path& second)
+{
+    if (std::filesystem::equivalent(first, second))
+        return (true);
+    if (std::filesystem::file_size(first) !=
+        std::filesystem::file_size(second))
+        return (false);
+
+    std::ifstream a(first, std::ios::binary);
+    std::ifstream b(second, std::ios::binary);
+    if (!a || !b)
+        return (false);
+
+    std::vector<char> left(64 * 1024), right(64 * 1024);
+    while (a && b) {
+        a.read(left.data(), left.size());
+        b.read(right.data(), right.size());
+        std::streamsize size = a.gcount();
+        if (size != b.gcount() ||
+            !std::equal(left.begin(), left.begin() + size, right.begin()))
+            return (false);
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AssetsPacker::sameContents(
+    const CompressedAsset& asset,
+    const Path& filepath
+)
+{
+    // Raw images and atlas regions no longer hold the file bytes
+    if (!asset.data || (asset.flags & (AssetFlag::Raw | AssetFlag::Atlased)))
+        return (false);
+    if (asset.size != std::filesystem::file_size(filepath))
+        return (false);
+
+    std::ifstream file(filepath, std::ios::binary);
+    UData bytes(asset.size);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), bytes.size()))
+        return (false);
+    return (decompressAsset(asset) == bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t AssetsPacker::addAssets(
+    const std::vector<std::pair<std::string, Path>>& entries,
+    size_t threads
+)
+{
+    using BlobId = std::pair<Uint64, AssetType>;
+    using Source = std::pair<Uint64, Int64>;
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    ThreadPool pool(threads);
+    std::vector<std::future<Source>> sources;
+    std::vector<std::future<CompressedAsset>> results(entries.size());
+    std::vector<size_t> owners(entries.size(), NONE);
+    std::vector<std::optional<CompressedAsset>> shared(entries.size());
+    std::vector<Uint64> hashes(entries.size(), 0);
+    std::vector<Int64> mtimes(entries.size(), 0);
+    std::map<BlobId, std::vector<size_t>> loaded;
+    std::map<BlobId, std::vector<std::string>> known;
+    size_t count = 0;
+    std::string errors;
+
+    auto fail = [&errors](const std::string& error){
+        errors += std::string(errors.empty() ? "" : "\n") + error;
+    };
+
+    // Hash every file first, so identical contents are compressed only once,
+    // files whose path and modification time did not change keep their hash
+    sources.reserve(entries.size());
+    for (const auto& [key, filepath] : entries) {
+        auto it = m_assets.find(key);
+        Source known = it != m_assets.end() &&
+            it->second.source == sourceHash(filepath)
+            ? Source(it->second.hash, it->second.mtime) : Source(0, 0);
+
+        Path path = filepath;
+        sources.push_back(pool.submit([path, known](void){
+            Int64 mtime = modificationTime(path);
+            if (known.first != 0 && known.second == mtime)
+                return (known);
+            return (Source(Hash::file(path), mtime));
+        }));
+    }
+
+    // Blobs already in the packer can be shared with the new keys, as long
+    // as they were compressed with the current encoding
+    Uint64 settings = settingsHash(m_encoding);
+    for (const auto& [key, asset] : m_assets) {
+        if (asset.hash != 0 && asset.settings == settings)
+            known[{asset.hash, asset.type}].push_back(key);
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        const auto& [key, filepath] = entries[i];
+
+        try {
+            std::tie(hashes[i], mtimes[i]) = sources[i].get();
+        } catch (const std::exception& error) {
+            fail(error.what());
+            continue;
+        }
+
+        // An unchanged file keeps the blob it already has, a new path or
+        // encoding compresses it again
+        auto it = m_assets.find(key);
+        if (it != m_assets.end() && it->second.mtime == mtimes[i] &&
+            it->second.hash == hashes[i] &&
+            it->second.source == sourceHash(filepath) &&
+            it->second.settings == settings)
+            continue;
+
+        // A hash match only shares the blob once the bytes are compared, so
+        // a collision can not serve the content of another file
+        BlobId id(hashes[i], detectAssetType(filepath));
+        try {
+            for (size_t owner : loaded[id]) {
+                if (sameContents(entries[owner].second, filepath)) {
+                    owners[i] = owner;
+                    break;
+                }
+            }
+            for (const std::string& other : known[id]) {
+                if (owners[i] != NONE)
+                    break;
+                if (sameContents(m_assets.at(other), filepath)) {
+                    shared[i] = m_assets.at(other);
+                    owners[i] = i;
+                }
+            }
+        } catch (const std::exception& error) {
+            fail(error.what());
+            continue;
+        }
+        if (owners[i] != NONE)
+            continue;
+
+        owners[i] = i;
+        loaded[id].push_back(i);
+        count++;
+
+        Path path = filepath;
+        Encoding encoding = m_encoding;
+        results[i] = pool.submit([path, encoding](void){
+            return (loadAsset(path, encoding));
+        });
+    }
+
+    // Results are collected in submission order so the final map does not
+    // depend on which worker finished first, duplicates share the blob of
+    // the first key holding the same content
+    std::vector<const CompressedAsset*> blobs(entries.size(), nullptr);
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (owners[i] == NONE)
+            continue;
+        try {
+            // The decoded copy of the replaced content leaves the cache
+            auto old = m_assets.find(entries[i].first);
+            if (old != m_assets.end())
+                uncache(old->first, old->second);
+
+            if (shared[i]) {
+                blobs[i] = &(m_assets[entries[i].first] = *shared[i]);
+            } else if (owners[i] == i) {
+                CompressedAsset asset = results[i].get();
+                asset.hash = hashes[i];
+                blobs[i] = &(m_assets[entries[i].first] = std::move(asset));
+            } else if (blobs[owners[i]]) {
+                blobs[i] = &(m_assets[entries[i].first] = *blobs[owners[i]]);
+            } else {
+                continue;
+            }
+            CompressedAsset& asset = m_assets[entries[i].first];
+            asset.mtime = mtimes[i];
+            asset.source = sourceHash(entries[i].second);
+            asset.settings = settings;
+        } catch (const std::exception& error) {
+            fail(error.what());
+        }
+    }
+
+    if (!errors.empty())
+        throw std::runtime_error(errors);
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::pair<std::string, AssetsPacker::Path>>
+AssetsPacker::scanDirectory(const Path& directory)
+{
+    if (!std::filesystem::is_directory(directory))
+        throw std::runtime_error("Not a directory: " + directory.string());
+
+    std::vector<std::pair<std::string, Path>> entries;
+
+    for (const auto& file :
+        std::filesystem::recursive_directory_iterator(directory)) {
+        if (!file.is_regular_file())
+            continue;
+        if (detectAssetType(file.path()) == AssetType::Unknown)
+            continue;
+        entries.emplace_back(
+            std::filesystem::relative(file.path(), directory).generic_string(),
+            file.path()
+        );
+    }
+
+    std::sort(entries.begin(), entries.end());
+    return (entries);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t AssetsPacker::addDirectory(const Path& directory, size_t threads)
+{
+    return (addAssets(scanDirectory(directory), threads));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::Update AssetsPacker::updateDirectory(
+    const Path& directory,
+    size_t threads
+)
+{
+    auto entries = scanDirectory(directory);
+    Update update{addAssets(entries, threads), 0};
+    std::unordered_set<std::string> found;
+
+    for (const auto& entry : entries)
+        found.insert(entry.first);
+
+    // Keys whose file is gone from the directory are dropped, the atlas
+    // pages are not files and only go once no image is cut out of them
+    for (auto it = m_assets.begin(); it != m_assets.end();) {
+        if (it->first.rfind(ATLAS_PREFIX, 0) != 0 && !found.count(it->first)) {
+            uncache(it->first, it->second);
+            it = m_assets.erase(it);
+            update.removed++;
+        } else {
+            ++it;
+        }
+    }
+
+    std::unordered_set<std::string> pages;
+    for (const auto& [key, asset] : m_assets) {
+        if (asset.flags & AssetFlag::Atlased)
+            pages.insert(asset.region.page);
+    }
+    for (auto it = m_assets.begin(); it != m_assets.end();) {
+        if (it->first.rfind(ATLAS_PREFIX, 0) == 0 && !pages.count(it->first)) {
+            uncache(it->first, it->second);
+            it = m_assets.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return (update);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::trainDictionaries(size_t capacity)
+{
+    // Small blobs are grouped per asset type, blobs shared by several keys
+    // are only counted once
+    std::map<
+        AssetType, std::map<const UData*, std::vector<CompressedAsset*>>
+    > families;
+    for (auto& [key, asset] : m_assets) {
+        if (
+            asset.size < DICTIONARY_THRESHOLD &&
+            !(asset.flags & (AssetFlag::Chunked | AssetFlag::Atlased))
+        ) families[asset.type][asset.data.get()].push_back(&asset);
+    }
+
+    int level = Compressor::defaultLevel(Compressor::Codec::Zstd);
+    for (auto& [type, blobs] : families) {
+        std::vector<UData> samples;
+        samples.reserve(blobs.size());
+        for (const auto& [blob, assets] : blobs)
+            samples.push_back(decompressAsset(*assets.front()));
+
+        auto dictionary = Compressor::trainDictionary(samples, capacity);
+        if (!dictionary)
+            continue;
+
+        // Blobs already using the previous dictionary of the type always
+        // switch to the new one, since only one is stored per type
+        size_t i = 0;
+        for (const auto& [blob, assets] : blobs) {
+            const CompressedAsset& first = *assets.front();
+            auto data = std::make_shared<const UData>(
+                Compressor::compress(samples[i++], *dictionary, level)
+            );
+            if (!first.dictionary && data->size() >= blob->size())
+                continue;
+
+            for (CompressedAsset* asset : assets) {
+                asset->data = data;
+                asset->codec = Compressor::Codec::Zstd;
+                asset->flags |= AssetFlag::Trained;
+                asset->dictionary = dictionary;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::bakeAtlases(Uint32 pageSize, Uint32 padding)
+{
+    struct Sprite
+    {
+        std::vector<std::string> keys;      //<! The keys sharing the image
+        ImagePtr image;                     //<! The decoded image
+    };
+
+    // Images are grouped by directory, where related sprites usually sit,
+    // and identical images take a single place in the page
+    std::map<std::string, std::vector<Sprite>> groups;
+    std::map<std::pair<std::string, Uint64>, std::vector<size_t>> shared;
+    std::vector<std::pair<std::string, ImagePtr>> standalone;
+
+    // Equal hashes only hint at equal images, the pixels decide
+    auto same = [](const sf::Image& first, const sf::Image& second){
+        sf::Vector2u size = first.getSize();
+        if (size != second.getSize())
+            return (false);
+        const Uint8* a = first.getPixelsPtr();
+        return (std::equal(
+            a, a + static_cast<size_t>(size.x) * size.y * 4,
+            second.getPixelsPtr()
+        ));
+    };
+
+    std::vector<std::string> keys;
+    for (const auto& [key, asset] : m_assets) {
+        if (
+            asset.type == AssetType::Image &&
+            key.rfind(ATLAS_PREFIX, 0) != 0
+        ) keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    for (const std::string& key : keys) {
+        const CompressedAsset& asset = m_assets.at(key);
+        auto image = getImage(key);
+        if (!image)
+            continue;
+
+        // Images bigger than a page are stored on their own
+        if (
+            asset.image.width + padding > pageSize ||
+            asset.image.height + padding > pageSize
+        ) {
+            if (asset.flags & AssetFlag::Atlased)
+                standalone.emplace_back(key, *image);
+            continue;
+        }
+
+        std::string group = Path(key).parent_path().generic_string();
+        std::vector<Sprite>& sprites = groups[group];
+        std::vector<size_t>& candidates = shared[{group, asset.hash}];
+        auto match = std::find_if(
+            candidates.begin(), candidates.end(), [&](size_t index){
+                return (
+                    asset.hash != 0 && same(*sprites[index].image, **image)
+                );
+            }
+        );
+        if (match != candidates.end()) {
+            sprites[*match].keys.push_back(key);
+        } else {
+            candidates.push_back(sprites.size());
+            sprites.push_back({{key}, *image});
+        }
+    }
+
+    // The previous pages are rebuilt from scratch
+    for (auto it = m_assets.begin(); it != m_assets.end();) {
+        if (it->first.rfind(ATLAS_PREFIX, 0) == 0) {
+            uncache(it->first, it->second);
+            it = m_assets.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Images leaving their atlas get their own blob back, still shared
+    std::map<Uint64, std::vector<std::pair<ImagePtr, CompressedAsset>>>
+        restored;
+    for (auto& [key, image] : standalone) {
+        Uint64 hash = m_assets[key].hash;
+        auto& candidates = restored[hash];
+        auto match = std::find_if(
+            candidates.begin(), candidates.end(), [&](const auto& other){
+                return (hash != 0 && same(*other.first, *image));
+            }
+        );
+        if (match == candidates.end()) {
+            candidates.emplace_back(image, compressPixels(*image));
+            match = std::prev(candidates.end());
+            match->second.hash = hash;
+        }
+        uncache(key, m_assets[key]);
+        m_assets[key] = match->second;
+    }
+
+    std::vector<stbrp_node> nodes(pageSize);
+    for (const auto& [group, sprites] : groups) {
+        std::vector<stbrp_rect> pending;
+        for (size_t i = 0; i < sprites.size(); i++) {
+            stbrp_rect rect{};
+            rect.id = static_cast<int>(i);
+            rect.w = sprites[i].image->getSize().x + padding;
+            rect.h = sprites[i].image->getSize().y + padding;
+            pending.push_back(rect);
+        }
+
+        for (size_t index = 0; !pending.empty(); index++) {
+            stbrp_context context;
+            stbrp_init_target(
+                &context, pageSize, pageSize, nodes.data(), nodes.size()
+            );
+            stbrp_pack_rects(&context, pending.data(), pending.size());
+
+            // The page is trimmed to the area actually used
+            sf::Vector2u size;
+            std::vector<stbrp_rect> packed, rest;
+            for (const stbrp_rect& rect : pending) {
+                if (!rect.was_packed) {
+                    rest.push_back(rect);
+                    continue;
+                }
+                packed.push_back(rect);
+                size.x = std::max<unsigned>(size.x, rect.x + rect.w - padding);
+                size.y = std::max<unsigned>(size.y, rect.y + rect.h - padding);
+            }
+            if (packed.empty())
+                break;
+
+            std::string page = ATLAS_PREFIX +
+                (group.empty() ? "" : group + "/") + std::to_string(index);
+            sf::Image atlas;
+            atlas.create(size.x, size.y, sf::Color::Transparent);
+
+            for (const stbrp_rect& rect : packed) {
+                const Sprite& sprite = sprites[rect.id];
+                atlas.copy(*sprite.image, rect.x, rect.y);
+
+                sf::IntRect area(
+                    rect.x, rect.y, rect.w - padding, rect.h - padding
+                );
+                for (const std::string& key : sprite.keys) {
+                    CompressedAsset& asset = m_assets[key];
+                    uncache(key, asset);
+                    asset.data = std::make_shared<const UData>();
+                    asset.size = 0;
+                    asset.codec = Compressor::Codec::Stored;
+                    asset.flags = AssetFlag::Atlased;
+                    asset.dictionary = nullptr;
+                    asset.region = {page, area};
+                }
+            }
+
+            m_assets[page] = compressPixels(atlas);
+            pending = std::move(rest);
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -105,11 +713,95 @@ AssetsPacker::AssetType AssetsPacker::detectAssetType(const Path& filepath)
         return (AssetType::Sound);
     if (ext == ".ttf" || ext == ".otf")
         return (AssetType::Font);
-    if (ext == ".bin" || ext == ".dat")
+    if (ext == ".bin" || ext == ".dat" || ext == ".map")
         return (AssetType::Data);
     return (AssetType::Unknown);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Int64 AssetsPacker::modificationTime(const Path& filepath)
+{
+    // The file clock epoch and period depend on the standard library, the
+    // pack stores nanoseconds since the Unix epoch instead
+    auto time = std::chrono::file_clock::to_sys(
+        std::filesystem::last_write_time(filepath)
+    );
+    return (static_cast<Int64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time.time_since_epoch()
+        ).count()
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 AssetsPacker::sourceHash(const Path& filepath)
+{
+    std::string path = std::filesystem::absolute(filepath)
+        .lexically_normal().generic_string();
+    return (Hash::fnv1a(path.data(), path.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 AssetsPacker::settingsHash(const Encoding& encoding)
+{
+    // Every field changes the produced blob, the budget only matters when
+    // the codec is picked automatically
+    Uint8 codec = static_cast<Uint8>(encoding.codec);
+    Uint64 hash = Hash::fnv1a(&codec, sizeof(codec));
+    hash = Hash::fnv1a(&encoding.level, sizeof(encoding.level), hash);
+    hash = Hash::fnv1a(&encoding.automatic, sizeof(encoding.automatic), hash);
+    if (encoding.automatic)
+        hash = Hash::fnv1a(&encoding.budget, sizeof(encoding.budget), hash);
+    return (Hash::fnv1a(
+        &encoding.rawImages, sizeof(encoding.rawImages), hash
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t AssetsPacker::decodedSize(const CompressedAsset& asset)
+{
+    if (asset.type == AssetType::Image && asset.image.width != 0) {
+        return (
+            static_cast<size_t>(asset.image.width) * asset.image.height * 4
+        );
+    }
+    if (asset.type == AssetType::Sound && asset.audio.sampleCount != 0)
+        return (asset.audio.sampleCount * sizeof(sf::Int16));
+    return (asset.size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string AssetsPacker::cacheKey(
+    const std::string& key,
+    const CompressedAsset& asset
+)
+{
+    // Decoded assets are cached by content, so keys holding the same file
+    // share the decoded asset, assets without a known hash are cached by
+    // name and encoding instead
+    std::string id = ':' + std::to_string(static_cast<int>(asset.type)) +
+        ':' + std::to_string(static_cast<int>(asset.codec)) +
+        ':' + std::to_string(asset.flags) +
+        ':' + std::to_string(asset.size);
+    if (asset.hash == 0)
+        return (key + id);
+    return ('#' + Hash::toHex(asset.hash) + id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData AssetsPacker::decompressAsset(const CompressedAsset& asset)
+{
+    if (asset.dictionary)
+        return (Compressor::decompress(
+            *asset.data, asset.size, *asset.dictionary
+        ));
+    if (asset.flags & AssetFlag::Chunked)
+        return (Compressor::decompressChunked(
+            *asset.data, asset.size, asset.codec
+        ));
+    return (Compressor::decompress(*asset.data, asset.size, asset.codec));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::string AssetsPacker::formatSize(size_t size)
 {
@@ -134,40 +826,137 @@ void AssetsPacker::pack(const std::string& filename) const
     if (!out)
         throw std::runtime_error("Cannot open file: " + filename);
 
-    // Write the assets signature
-    out.write(ASSETS_SIGNATURE, 9);
+    // Sort the keys so the same assets always produce the same file
+    std::vector<const std::pair<const std::string, CompressedAsset>*> entries;
+    entries.reserve(m_assets.size());
+    for (const auto& entry : m_assets)
+        entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(), [](auto lhs, auto rhs){
+        return (lhs->first < rhs->first);
+    });
+
+    // The table of contents is built first, its size and checksum are written
+    // before it so it can be validated before trusting any offset
+    std::ostringstream toc;
+
+    // Write the dictionaries, at most one per asset type
+    std::map<AssetType, const Compressor::Dictionary*> dictionaries;
+    for (const auto* entry : entries) {
+        if (entry->second.dictionary) {
+            dictionaries.emplace(
+                entry->second.type, entry->second.dictionary.get()
+            );
+        }
+    }
+
+    Uint32 dcount = static_cast<Uint32>(dictionaries.size());
+    toc.write(CRCASTOF(dcount));
+    for (const auto& [type, dictionary] : dictionaries) {
+        const UData& content = dictionary->getContent();
+        Uint8 dtype = static_cast<Uint8>(type);
+        Uint32 dsize = static_cast<Uint32>(content.size());
+        toc.write(CRCASTOF(dtype));
+        toc.write(CRCASTOF(dsize));
+        toc.write(reinterpret_cast<const char*>(content.data()), dsize);
+    }
 
     // Write the number of assets
-    Uint32 count = static_cast<Uint32>(m_assets.size());
-    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    Uint32 count = static_cast<Uint32>(entries.size());
+    toc.write(CRCASTOF(count));
+
+    // Write the table of contents, the blobs follow it in the same order and
+    // keys sharing a blob share its offset and checksum
+    std::unordered_map<const UData*, std::pair<Uint64, Uint32>> offsets;
+    std::vector<const UData*> blobs;
+    Uint64 end = 0;
+    for (const auto* entry : entries) {
+        const std::string& key = entry->first;
+        const CompressedAsset& asset = entry->second;
 
-    for (const auto& [key, asset] : m_assets) {
         // Write the asset key length and key
         Uint32 length = static_cast<Uint32>(key.size());
-        out.write(CRCASTOF(length));
-        out.write(key.data(), length);
+        toc.write(CRCASTOF(length));
+        toc.write(key.data(), length);
+
+        // Write the asset type, codec and flags
+        Uint8 type = static_cast<Uint8>(asset.type);
+        Uint8 codec = static_cast<Uint8>(asset.codec);
+        toc.write(CRCASTOF(type));
+        toc.write(CRCASTOF(codec));
+        toc.write(CRCASTOF(asset.flags));
 
-        // Write the asset type
-        out.write(CRCASTOF(asset.type));
-        // Write the asset data size
-        out.write(CRCASTOF(asset.size));
+        // Write the original size, the compressed size, the blob offset and
+        // the blob checksum. Atlased images, resolved through their page, and
+        // empty blobs own no bytes, so they can not take the offset of the
+        // next blob.
+        Uint64 size = asset.size;
+        Uint64 csize = asset.data->size();
+        std::pair<Uint64, Uint32> location(
+            NO_BLOB, Hash::crc32c(asset.data->data(), 0)
+        );
+        if (csize != 0 && !(asset.flags & AssetFlag::Atlased)) {
+            auto [blob, inserted] = offsets.try_emplace(asset.data.get());
+            if (inserted) {
+                blob->second = {end, Hash::crc32c(asset.data->data(), csize)};
+                blobs.push_back(asset.data.get());
+                end += csize;
+            }
+            location = blob->second;
+        } else
+            csize = 0;
+        toc.write(CRCASTOF(size));
+        toc.write(CRCASTOF(csize));
+        toc.write(CRCASTOF(location.first));
+        toc.write(CRCASTOF(location.second));
+
+        // Write the content hash, the source modification time and the
+        // hashes of the source path and encoding
+        toc.write(CRCASTOF(asset.hash));
+        toc.write(CRCASTOF(asset.mtime));
+        toc.write(CRCASTOF(asset.source));
+        toc.write(CRCASTOF(asset.settings));
 
         // Write the metadata if applicable
         if (asset.type == AssetType::Image) {
-            out.write(CRCASTOF(asset.image.width));
-            out.write(CRCASTOF(asset.image.height));
+            toc.write(CRCASTOF(asset.image.width));
+            toc.write(CRCASTOF(asset.image.height));
+
+            // Write the decode times of raw images
+            if (asset.flags & AssetFlag::Raw) {
+                toc.write(CRCASTOF(asset.image.sourceTime));
+                toc.write(CRCASTOF(asset.image.rawTime));
+            }
+
+            // Write the page and the position of atlased images
+            if (asset.flags & AssetFlag::Atlased) {
+                const AtlasRegion& region = asset.region;
+                Uint32 plength = static_cast<Uint32>(region.page.size());
+                Uint32 x = region.rect.left, y = region.rect.top;
+                toc.write(CRCASTOF(plength));
+                toc.write(region.page.data(), plength);
+                toc.write(CRCASTOF(x));
+                toc.write(CRCASTOF(y));
+            }
         } else if (asset.type == AssetType::Sound) {
-            out.write(CRCASTOF(asset.audio.channelCount));
-            out.write(CRCASTOF(asset.audio.sampleRate));
-            out.write(CRCASTOF(asset.audio.sampleCount));
+            Uint64 samples = asset.audio.sampleCount;
+            toc.write(CRCASTOF(asset.audio.channelCount));
+            toc.write(CRCASTOF(asset.audio.sampleRate));
+            toc.write(CRCASTOF(samples));
         }
-
-        // Write the compressed data
-        out.write(
-            reinterpret_cast<const char*>(asset.data.data()),
-            asset.size
-        );
     }
+
+    // Write the signature, then the checksummed table of contents
+    std::string table = toc.str();
+    Uint64 tocSize = table.size();
+    Uint32 tocCrc = Hash::crc32c(table.data(), table.size());
+    out.write(ASSETS_SIGNATURE_V2, 9);
+    out.write(CRCASTOF(tocSize));
+    out.write(CRCASTOF(tocCrc));
+    out.write(table.data(), table.size());
+
+    // Write the compressed data
+    for (const UData* data : blobs)
+        out.write(reinterpret_cast<const char*>(data->data()), data->size());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -180,20 +969,54 @@ void AssetsPacker::unpack(const std::string& filename)
     // Read the signature of the file
     char signature[9];
     in.read(signature, 9);
-    if (std::string(signature, 9) != ASSETS_SIGNATURE)
+
+    // Clear the previous assets
+    m_assets.clear();
+    m_cache.clear();
+    m_checksums.clear();
+
+    if (std::string(signature, 9) == ASSETS_SIGNATURE_V2)
+        unpackV2(in);
+    else if (std::string(signature, 9) == ASSETS_SIGNATURE)
+        unpackV1(in);
+    else
         throw std::runtime_error("Invalid asset file signature");
 
+    if (m_verification == Verification::Eager) {
+        auto corrupted = verify();
+        if (!corrupted.empty()) {
+            m_assets.clear();
+            m_checksums.clear();
+            throw std::runtime_error("Corrupted asset: " + corrupted.front());
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::unpackV1(std::istream& in)
+{
+    // Version 1 has no table of contents, so every length is checked against
+    // the bytes left in the stream before anything is allocated for it
+    std::streampos start = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streampos last = in.tellg();
+    in.seekg(start);
+    auto require = [&](Uint64 length){
+        std::streampos position = in.tellg();
+        if (!in || length > static_cast<Uint64>(last - position))
+            throw std::runtime_error("Truncated asset file");
+    };
+
     // Read the number of assets in the file
     Uint32 count = 0;
     in.read(RCASTOF(count));
-
-    // Clear the previous assets
-    m_assets.clear();
+    require(count);
 
     for (Uint32 i = 0; i < count; i++) {
         // Read the key length and the key
         Uint32 length = 0;
         in.read(RCASTOF(length));
+        require(length);
         std::string key(length, '\0');
         in.read(key.data(), length);
 
@@ -202,11 +1025,14 @@ void AssetsPacker::unpack(const std::string& filename)
         in.read(RCASTOF(type));
 
         // Read the data size of the asset
-        size_t size;
+        size_t size = 0;
         in.read(RCASTOF(size));
 
         // Create a new asset base on the size and type
-        CompressedAsset asset{{}, size, type, {}};
+        CompressedAsset asset{
+            nullptr, size, type, Compressor::Codec::Zlib,
+            0, 0, 0, 0, 0, nullptr, {}, {}
+        };
 
         // Read the metadata if applicable
         if (type == AssetType::Image) {
@@ -218,15 +1044,225 @@ void AssetsPacker::unpack(const std::string& filename)
             in.read(RCASTOF(asset.audio.sampleCount));
         }
 
-        // Read the compressed data
-        asset.data.resize(size);
-        in.read(reinterpret_cast<char*>(asset.data.data()), size);
+        // Version 1 stored the compressed stream padded to the original size
+        require(size);
+        auto data = std::make_shared<UData>(size);
+        in.read(reinterpret_cast<char*>(data->data()), size);
+        if (!in)
+            throw std::runtime_error("Truncated asset file");
+        asset.data = data;
 
         // Save the asset in the map of assets
         m_assets[key] = std::move(asset);
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::unpackV2(std::istream& in)
+{
+    // Measure the bytes left after the header so no size read from the file
+    // is trusted beyond them
+    Uint64 tocSize = 0;
+    Uint32 tocCrc = 0;
+    in.read(RCASTOF(tocSize));
+    in.read(RCASTOF(tocCrc));
+
+    std::streampos start = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streampos last = in.tellg();
+    in.seekg(start);
+    if (!in || static_cast<Uint64>(last - start) < tocSize)
+        throw std::runtime_error("Truncated asset file");
+    Uint64 blobSize = static_cast<Uint64>(last - start) - tocSize;
+
+    // Read the table of contents and check it before parsing anything
+    std::string toc(tocSize, '\0');
+    in.read(toc.data(), tocSize);
+    if (!in || Hash::crc32c(toc.data(), toc.size()) != tocCrc)
+        throw std::runtime_error("Corrupted table of contents");
+
+    std::istringstream table(std::move(toc));
+    auto require = [&](Uint64 length){
+        std::streampos position = table.tellg();
+        if (!table || length > tocSize - static_cast<Uint64>(position))
+            throw std::runtime_error("Truncated table of contents");
+    };
+
+    // Read the dictionaries
+    Uint32 dcount = 0;
+    table.read(RCASTOF(dcount));
+
+    std::map<AssetType, DictionaryPtr> dictionaries;
+    for (Uint32 i = 0; i < dcount; i++) {
+        Uint8 type = 0;
+        Uint32 size = 0;
+        table.read(RCASTOF(type));
+        table.read(RCASTOF(size));
+        require(size);
+        UData content(size);
+        table.read(reinterpret_cast<char*>(content.data()), size);
+        dictionaries[static_cast<AssetType>(type)] =
+            std::make_shared<const Compressor::Dictionary>(std::move(content));
+    }
+
+    // Read the number of assets in the file
+    Uint32 count = 0;
+    table.read(RCASTOF(count));
+    require(count);
+
+    std::vector<std::tuple<std::string, Uint64, Uint64, Uint32, Uint8>> blobs;
+    blobs.reserve(count);
+
+    // Read the table of contents
+    for (Uint32 i = 0; i < count; i++) {
+        // Read the key length and the key
+        Uint32 length = 0;
+        table.read(RCASTOF(length));
+        require(length);
+        std::string key(length, '\0');
+        table.read(key.data(), length);
+
+        // Read the type, the codec and the flags of the asset
+        Uint8 type = 0, codec = 0, flags = 0;
+        table.read(RCASTOF(type));
+        table.read(RCASTOF(codec));
+        table.read(RCASTOF(flags));
+
+        // Read the sizes, the offset and the checksum of the blob
+        Uint64 size = 0, csize = 0, offset = 0;
+        Uint32 crc = 0;
+        table.read(RCASTOF(size));
+        table.read(RCASTOF(csize));
+        table.read(RCASTOF(offset));
+        table.read(RCASTOF(crc));
+        if (
+            offset != NO_BLOB &&
+            (csize > blobSize || offset > blobSize - csize)
+        )
+            throw std::runtime_error("Blob out of bounds for " + key);
+
+        // Read the content hash, the source modification time and the
+        // hashes of the source path and encoding
+        Uint64 hash = 0;
+        Int64 mtime = 0;
+        Uint64 source = 0;
+        Uint64 settings = 0;
+        table.read(RCASTOF(hash));
+        table.read(RCASTOF(mtime));
+        table.read(RCASTOF(source));
+        table.read(RCASTOF(settings));
+
+        CompressedAsset asset{
+            nullptr,
+            size,
+            static_cast<AssetType>(type),
+            static_cast<Compressor::Codec>(codec),
+            flags,
+            hash,
+            mtime,
+            source,
+            settings,
+            nullptr,
+            {},
+            {}
+        };
+
+        // Attach the dictionary of the asset type if the blob needs it
+        if (flags & AssetFlag::Trained) {
+            auto dictionary = dictionaries.find(asset.type);
+            if (dictionary == dictionaries.end())
+                throw std::runtime_error("Missing dictionary for " + key);
+            asset.dictionary = dictionary->second;
+        }
+
+        // Read the metadata if applicable
+        if (asset.type == AssetType::Image) {
+            table.read(RCASTOF(asset.image.width));
+            table.read(RCASTOF(asset.image.height));
+
+            // Read the decode times of raw images
+            if (asset.flags & AssetFlag::Raw) {
+                table.read(RCASTOF(asset.image.sourceTime));
+                table.read(RCASTOF(asset.image.rawTime));
+            }
+
+            // Read the page and the position of atlased images
+            if (asset.flags & AssetFlag::Atlased) {
+                Uint32 plength = 0, x = 0, y = 0;
+                table.read(RCASTOF(plength));
+                require(plength);
+                asset.region.page.resize(plength);
+                table.read(asset.region.page.data(), plength);
+                table.read(RCASTOF(x));
+                table.read(RCASTOF(y));
+                asset.region.rect = sf::IntRect(
+                    x, y, asset.image.width, asset.image.height
+                );
+            }
+        } else if (asset.type == AssetType::Sound) {
+            Uint64 samples = 0;
+            table.read(RCASTOF(asset.audio.channelCount));
+            table.read(RCASTOF(asset.audio.sampleRate));
+            table.read(RCASTOF(samples));
+            asset.audio.sampleCount = samples;
+        }
+
+        blobs.emplace_back(key, offset, csize, crc, codec);
+        m_assets[key] = std::move(asset);
+    }
+
+    if (!table)
+        throw std::runtime_error("Truncated table of contents");
+
+    // Read the compressed data, each blob once whatever its number of keys.
+    // A blob is told apart by its size and codec too, as an empty blob
+    // written by an older packer shares the offset of the next one.
+    start = in.tellg();
+    std::map<std::tuple<Uint64, Uint64, Uint8>, Blob> shared;
+    for (const auto& [key, offset, csize, crc, codec] : blobs) {
+        if (offset == NO_BLOB) {
+            m_assets[key].data = std::make_shared<const UData>();
+            continue;
+        }
+
+        Blob& blob = shared[{offset, csize, codec}];
+        if (!blob) {
+            auto data = std::make_shared<UData>(csize);
+            in.seekg(start + static_cast<std::streamoff>(offset));
+            in.read(reinterpret_cast<char*>(data->data()), csize);
+            blob = data;
+            m_checksums[blob.get()] = {blob, crc, false};
+        }
+        m_assets[key].data = blob;
+    }
+
+    if (!in)
+        throw std::runtime_error("Truncated asset file");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::checkAsset(
+    const std::string& key,
+    const CompressedAsset& asset
+) const
+{
+    if (m_verification != Verification::FirstUse)
+        return;
+
+    // Only blobs read from a pack have a checksum, each is checked once
+    std::lock_guard<std::mutex> lock(m_checkMutex);
+    auto it = m_checksums.find(asset.data.get());
+    if (it == m_checksums.end() || it->second.verified)
+        return;
+    if (it->second.blob.expired()) {
+        m_checksums.erase(it);
+        return;
+    }
+    if (Hash::crc32c(asset.data->data(), asset.data->size()) != it->second.crc)
+        throw std::runtime_error("Corrupted asset: " + key);
+    it->second.verified = true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void AssetsPacker::addAsset(const std::string& key, const Path& filepath)
 {
@@ -242,12 +1278,34 @@ std::optional<AssetsPacker::ImagePtr> AssetsPacker::getImage(
     if (it == m_assets.end() || it->second.type != AssetType::Image)
         return (std::nullopt);
 
-    auto data = Compressor::decompress(it->second.data, it->second.size);
+    std::string id = cacheKey(key, it->second);
+    if (auto cached = getCached<sf::Image>(id))
+        return (cached);
 
     auto img = std::make_shared<sf::Image>();
-    if (!img->loadFromMemory(data.data(), data.size()))
-        return (std::nullopt);
 
+    // Atlased images are cut out of their page
+    if (it->second.flags & AssetFlag::Atlased) {
+        const AtlasRegion& region = it->second.region;
+        auto page = getImage(region.page);
+        if (!page)
+            return (std::nullopt);
+        img->create(region.rect.width, region.rect.height);
+        img->copy(**page, 0, 0, region.rect);
+    } else if (it->second.flags & AssetFlag::Raw) {
+        checkAsset(key, it->second);
+        auto data = decompressAsset(it->second);
+        img->create(
+            it->second.image.width, it->second.image.height, data.data()
+        );
+    } else {
+        checkAsset(key, it->second);
+        auto data = decompressAsset(it->second);
+        if (!img->loadFromMemory(data.data(), data.size()))
+            return (std::nullopt);
+    }
+
+    cache(id, img, decodedSize(it->second));
     return (img);
 }
 
@@ -260,15 +1318,182 @@ std::optional<AssetsPacker::SoundPtr> AssetsPacker::getSound(
     if (it == m_assets.end() || it->second.type != AssetType::Sound)
         return (std::nullopt);
 
-    auto data = Compressor::decompress(it->second.data, it->second.size);
+    std::string id = cacheKey(key, it->second);
+    if (auto cached = getCached<sf::SoundBuffer>(id))
+        return (cached);
 
+    // Chunked sounds are decoded one block at a time by the stream
+    auto stream = openStream(key);
     auto buffer = std::make_shared<sf::SoundBuffer>();
-    if (!buffer->loadFromMemory(data.data(), data.size()))
+    if (!stream || !buffer->loadFromStream(*stream))
         return (std::nullopt);
 
+    cache(id, buffer, decodedSize(it->second));
     return (buffer);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::optional<AssetsPacker::MusicPtr> AssetsPacker::getMusic(
+    const std::string& key
+)
+{
+    auto it = m_assets.find(key);
+    if (it == m_assets.end() || it->second.type != AssetType::Sound)
+        return (std::nullopt);
+
+    // The music reads from the stream while it plays, so the deleter keeps
+    // the stream alive until the music is destroyed
+    std::shared_ptr<AssetStream> stream = openStream(key);
+    if (!stream)
+        return (std::nullopt);
+    auto music = std::shared_ptr<sf::Music>(
+        new sf::Music(),
+        [stream](sf::Music* music) { delete music; }
+    );
+    if (!music->openFromStream(*stream))
+        return (std::nullopt);
+    return (music);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<AssetStream> AssetsPacker::openStream(
+    const std::string& key
+) const
+{
+    auto it = m_assets.find(key);
+    if (it == m_assets.end())
+        return (nullptr);
+
+    const CompressedAsset& asset = it->second;
+    checkAsset(key, asset);
+
+    // A malformed block table fails the open like a missing key does
+    try {
+        return (std::make_unique<AssetStream>(
+            asset.data, asset.size, asset.codec,
+            (asset.flags & AssetFlag::Chunked) != 0, asset.dictionary
+        ));
+    } catch (const std::exception&) {
+        return (nullptr);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<AssetsPacker::AtlasRegion> AssetsPacker::getRegion(
+    const std::string& key
+) const
+{
+    auto it = m_assets.find(key);
+    if (it == m_assets.end() || it->second.type != AssetType::Image)
+        return (std::nullopt);
+
+    // A standalone image is a page of its own
+    const CompressedAsset& asset = it->second;
+    if (asset.flags & AssetFlag::Atlased)
+        return (asset.region);
+    return (AtlasRegion{
+        key, sf::IntRect(0, 0, asset.image.width, asset.image.height)
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::extract(const std::string& key, const Path& filepath)
+{
+    auto it = m_assets.find(key);
+    if (it == m_assets.end())
+        throw std::runtime_error("Cannot find: " + key);
+
+    // Raw and atlased images no longer hold their source file, they are
+    // encoded again from their pixels as PNG whatever the extension of the
+    // target is
+    const CompressedAsset& asset = it->second;
+    if (
+        asset.type == AssetType::Image &&
+        asset.flags & (AssetFlag::Raw | AssetFlag::Atlased)
+    ) {
+        auto image = getImage(key);
+        UData png;
+        if (!image || !(*image)->saveToMemory(png, "png"))
+            throw std::runtime_error("Cannot extract: " + key);
+
+        std::ofstream out(filepath, std::ios::binary);
+        if (!out)
+            throw std::runtime_error("Cannot open file: " + filepath.string());
+        out.write(reinterpret_cast<const char*>(png.data()), png.size());
+        return;
+    }
+
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out)
+        throw std::runtime_error("Cannot open file: " + filepath.string());
+
+    // Other assets are written back as the bytes of their source file, a
+    // stored blob is written as it is without decoding it into a copy
+    checkAsset(key, asset);
+    if (
+        asset.codec == Compressor::Codec::Stored &&
+        !(asset.flags & AssetFlag::Chunked) && !asset.dictionary
+    ) {
+        out.write(
+            reinterpret_cast<const char*>(asset.data->data()),
+            asset.data->size()
+        );
+    } else {
+        UData data = decompressAsset(asset);
+        out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    if (!out)
+        throw std::runtime_error("Cannot write file: " + filepath.string());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t AssetsPacker::extractAll(const Path& directory, size_t threads)
+{
+    std::vector<std::pair<std::string, Path>> entries;
+
+    // Atlas pages are build artifacts, their images are extracted instead
+    for (const auto& [key, asset] : m_assets) {
+        if (key.rfind(ATLAS_PREFIX, 0) == 0)
+            continue;
+        Path relative = Path(key).lexically_normal();
+        if (
+            relative.empty() || relative.is_absolute() ||
+            *relative.begin() == ".."
+        ) throw std::runtime_error("Invalid key for a file: " + key);
+        entries.emplace_back(key, directory / relative);
+    }
+    std::sort(entries.begin(), entries.end());
+
+    // The directories are created up front so the workers only write files
+    for (const auto& [key, filepath] : entries)
+        std::filesystem::create_directories(filepath.parent_path());
+
+    ThreadPool pool(threads);
+    std::vector<std::future<void>> results;
+    results.reserve(entries.size());
+    for (const auto& [key, filepath] : entries) {
+        results.push_back(pool.submit([this, key, filepath](void){
+            extract(key, filepath);
+        }));
+    }
+
+    size_t extracted = 0;
+    std::string errors;
+    for (auto& result : results) {
+        try {
+            result.get();
+            extracted++;
+        } catch (const std::exception& error) {
+            errors += std::string(errors.empty() ? "" : "\n") + error.what();
+        }
+    }
+
+    if (!errors.empty())
+        throw std::runtime_error(errors);
+    return (extracted);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::optional<AssetsPacker::FontPtr> AssetsPacker::getFont(
     const std::string& key
@@ -278,12 +1503,22 @@ std::optional<AssetsPacker::FontPtr> AssetsPacker::getFont(
     if (it == m_assets.end() || it->second.type != AssetType::Font)
         return (std::nullopt);
 
-    auto data = Compressor::decompress(it->second.data, it->second.size);
+    std::string id = cacheKey(key, it->second);
+    if (auto cached = getCached<sf::Font>(id))
+        return (cached);
 
-    auto font = std::make_shared<sf::Font>();
-    if (!font->loadFromMemory(data.data(), data.size()))
+    // sf::Font reads its glyphs lazily from the source buffer, the buffer
+    // must therefore live as long as the font itself
+    checkAsset(key, it->second);
+    auto data = std::make_shared<UData>(
+        decompressAsset(it->second)
+    );
+
+    FontPtr font(new sf::Font(), [data](sf::Font* ptr){ delete ptr; });
+    if (!font->loadFromMemory(data->data(), data->size()))
         return (std::nullopt);
 
+    cache(id, font, decodedSize(it->second));
     return (font);
 }
 
@@ -296,9 +1531,17 @@ std::optional<AssetsPacker::DataPtr> AssetsPacker::getData(
     if (it == m_assets.end() || it->second.type != AssetType::Data)
         return (std::nullopt);
 
-    auto data = Compressor::decompress(it->second.data, it->second.size);
+    std::string id = cacheKey(key, it->second);
+    if (auto cached = getCached<UData>(id))
+        return (cached);
+
+    checkAsset(key, it->second);
+    auto data = std::make_shared<UData>(
+        decompressAsset(it->second)
+    );
 
-    return (std::make_shared<UData>(data));
+    cache(id, data, decodedSize(it->second));
+    return (data);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -309,10 +1552,107 @@ std::unordered_map<
     return (m_assets);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> AssetsPacker::verify(void) const
+{
+    std::lock_guard<std::mutex> lock(m_checkMutex);
+
+    // Shared blobs are checked once, a mismatch reports all of their keys
+    std::unordered_map<const UData*, bool> valid;
+    std::vector<std::string> corrupted;
+    for (const auto& [key, asset] : m_assets) {
+        auto it = m_checksums.find(asset.data.get());
+        if (it == m_checksums.end() || it->second.blob.expired())
+            continue;
+
+        auto [status, inserted] = valid.try_emplace(asset.data.get());
+        if (inserted) {
+            status->second = Hash::crc32c(
+                asset.data->data(), asset.data->size()
+            ) == it->second.crc;
+            it->second.verified = status->second;
+        }
+        if (!status->second)
+            corrupted.push_back(key);
+    }
+
+    std::sort(corrupted.begin(), corrupted.end());
+    return (corrupted);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void AssetsPacker::clear(void)
 {
     m_assets.clear();
+    m_cache.clear();
+    m_checksums.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::setEncoding(const Encoding& encoding)
+{
+    m_encoding = encoding;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::Encoding AssetsPacker::getEncoding(void) const
+{
+    return (m_encoding);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::setVerification(Verification verification)
+{
+    m_verification = verification;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsPacker::Verification AssetsPacker::getVerification(void) const
+{
+    return (m_verification);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::setCacheBudget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.setBudget(budget);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetsCache::Stats AssetsPacker::getCacheStats(void) const
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    return (m_cache.getStats());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::clearCache(void)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::cache(
+    const std::string& key,
+    AssetsCache::Asset asset,
+    size_t cost
+)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.insert(key, std::move(asset), cost);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetsPacker::uncache(
+    const std::string& key,
+    const CompressedAsset& asset
+)
+{
+    // Other keys holding the same content only decode it again
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.erase(cacheKey(key, asset));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -331,7 +1671,9 @@ std::ostream& operator<<(std::ostream& os, const AssetsPacker& packer)
             length = key.length();
     }
 
-    os << std::setprecision(3);
+    // The caller's formatting is restored once the table is printed
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision(3);
     for (const auto& [key, asset] : assets) {
         if (idx != size - 1)
             os << " ├─ ";
@@ -350,10 +1692,37 @@ std::ostream& operator<<(std::ostream& os, const AssetsPacker& packer)
         os << ' ' << key;
         for (size_t i = key.length(); i < length + 4; i++)
             os << ' ';
-        os  << AssetsPacker::formatSize(asset.size) << std::endl;
+        os  << std::left << std::setw(12)
+            << AssetsPacker::formatSize(asset.size) << "-> "
+            << std::setw(12) << AssetsPacker::formatSize(asset.data->size())
+            << (asset.flags & AssetsPacker::AssetFlag::Atlased
+                ? "in " + asset.region.page
+                : Compressor::getName(asset.codec) +
+                    (asset.dictionary ? "+dict" : ""))
+            << std::right;
+
+        // Raw images show the decode time they save over their source
+        if (asset.flags & AssetsPacker::AssetFlag::Raw) {
+            os  << "  raw, decode " << asset.image.sourceTime / 1000.0
+                << " ms -> " << asset.image.rawTime / 1000.0 << " ms";
+        }
+        os << std::endl;
         idx++;
     }
-    os << std::defaultfloat;
+
+    // Summary of the space saved by sharing identical blobs
+    std::unordered_set<const UData*> blobs;
+    size_t total = 0, unique = 0;
+    for (const auto& [key, asset] : assets) {
+        total += asset.data->size();
+        if (blobs.insert(asset.data.get()).second)
+            unique += asset.data->size();
+    }
+    os  << ' ' << blobs.size() << " unique blobs for " << size << " assets, "
+        << AssetsPacker::formatSize(total - unique)
+        << " saved by deduplication" << std::endl;
+    os.flags(flags);
+    os.precision(precision);
     return (os);
 }
 
@@ -33,6 +33,9 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "utils/Types.hpp"
+#include "resources/AssetsCache.hpp"
+#include "resources/Compressor.hpp"
+#include "resources/AssetStream.hpp"
 #include <SFML/Audio.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Graphics.hpp>
@@ -44,6 +47,8 @@
 #include <optional>
 #include <iostream>
 #include <variant>
+#include <vector>
+#include <mutex>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -54,16 +59,22 @@ namespace tkd
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief Assets packer class to handle assets
 ///
+/// The getters may be called from several threads at once, as long as no
+/// asset is added, unpacked or cleared meanwhile.
+///
 ///////////////////////////////////////////////////////////////////////////////
 class AssetsPacker
 {
 public:
-    using ImagePtr     = std::shared_ptr<sf::Image>;
-    using SoundPtr     = std::shared_ptr<sf::SoundBuffer>;
-    using FontPtr      = std::shared_ptr<sf::Font>;
-    using DataPtr      = std::shared_ptr<UData>;
-    using AssetVariant = std::variant<ImagePtr, SoundPtr, FontPtr, DataPtr>;
-    using Path         = std::filesystem::path;
+    using ImagePtr      = std::shared_ptr<sf::Image>;
+    using SoundPtr      = std::shared_ptr<sf::SoundBuffer>;
+    using FontPtr       = std::shared_ptr<sf::Font>;
+    using DataPtr       = std::shared_ptr<UData>;
+    using MusicPtr      = std::shared_ptr<sf::Music>;
+    using Blob          = std::shared_ptr<const UData>;
+    using DictionaryPtr = std::shared_ptr<const Compressor::Dictionary>;
+    using AssetVariant  = std::variant<ImagePtr, SoundPtr, FontPtr, DataPtr>;
+    using Path          = std::filesystem::path;
 
 public:
     enum class AssetType
@@ -75,17 +86,41 @@ public:
         Unknown
     };
 
+    enum AssetFlag : Uint8
+    {
+        Chunked = 1 << 0,                   //<! Blob split in blocks
+        Trained = 1 << 1,                   //<! Blob needs the dictionary
+        Atlased = 1 << 2,                   //<! Image stored in an atlas
+        Raw = 1 << 3                        //<! Image stored as RGBA pixels
+    };
+
+    struct AtlasRegion
+    {
+        std::string page;                   //<! The key of the atlas page
+        sf::IntRect rect;                   //<! The image in the page
+    };
+
     struct CompressedAsset
     {
-        UData data;                         //<! The compressed data
+        Blob data;                          //<! The compressed data
         size_t size;                        //<! The size of the data
         AssetType type;                     //<! The type of asset
+        Compressor::Codec codec;            //<! The compression codec
+        Uint8 flags;                        //<! The asset flags
+        Uint64 hash;                        //<! The content hash, 0 if unknown
+        Int64 mtime;                        //<! The source time, 0 if unknown
+        Uint64 source;                      //<! The source path hash
+        Uint64 settings;                    //<! The encoding hash
+        DictionaryPtr dictionary;           //<! The dictionary, if trained
+        AtlasRegion region;                 //<! The atlas page, if atlased
         union
         {
             struct
             {
                 Uint32 width;               //<! The width of the image
                 Uint32 height;              //<! The height of the image
+                Uint32 sourceTime;          //<! Source decode time in us
+                Uint32 rawTime;             //<! Raw decode time in us
             } image;                        //<! Image related metadata
             struct
             {
@@ -96,21 +131,111 @@ public:
         };
     };
 
+    enum class Verification
+    {
+        None,                               //<! Trust the blobs
+        Eager,                              //<! Check every blob on unpack
+        FirstUse                            //<! Check a blob on first decode
+    };
+
+    struct Encoding
+    {
+        Compressor::Codec codec;            //<! The codec to compress with
+        int level;                          //<! The codec specific level
+        bool automatic;                     //<! Benchmark codecs per asset
+        double budget;                      //<! Decode budget in ms per Mo
+        bool rawImages;                     //<! Store images as RGBA pixels
+    };
+
+    struct Update
+    {
+        size_t recompressed;                //<! The files compressed again
+        size_t removed;                     //<! The keys without a file left
+    };
+
 private:
     std::unordered_map<std::string, CompressedAsset> m_assets;
-    int m_level;
+    AssetsCache m_cache;
+    mutable std::mutex m_cacheMutex;
+    Encoding m_encoding;
+    Verification m_verification;
+
+    struct Checksum
+    {
+        std::weak_ptr<const UData> blob;    //<! The blob read from the pack
+        Uint32 crc;                         //<! The CRC32C of the blob
+        bool verified;                      //<! Whether it was checked yet
+    };
+
+    mutable std::unordered_map<const UData*, Checksum> m_checksums;
+    mutable std::mutex m_checkMutex;
 
 private:
     static const char* ASSETS_SIGNATURE;
+    static const char* ASSETS_SIGNATURE_V2;
+    static const char* ATLAS_PREFIX;
+    static constexpr Uint64 NO_BLOB = ~static_cast<Uint64>(0);
+
+public:
+    static constexpr Uint64 CHUNK_THRESHOLD = 1024 * 1024;
+    static constexpr Uint64 DICTIONARY_THRESHOLD = 64 * 1024;
+    static constexpr Uint32 DEFAULT_ATLAS_SIZE = 2048;
 
 public:
-    AssetsPacker(int level = Z_DEFAULT_COMPRESSION);
+    AssetsPacker(
+        int level = Z_DEFAULT_COMPRESSION,
+        size_t cacheBudget = AssetsCache::DEFAULT_BUDGET
+    );
 
 public:
     AssetsPacker& operator<<(const std::pair<std::string, Path>& entry);
 
 private:
-    AssetType detectAssetType(const Path& filepath);
+    static AssetType detectAssetType(const Path& filepath);
+    static Int64 modificationTime(const Path& filepath);
+    static Uint64 sourceHash(const Path& filepath);
+    static Uint64 settingsHash(const Encoding& encoding);
+    static std::vector<std::pair<std::string, Path>> scanDirectory(
+        const Path& directory
+    );
+    static bool sameContents(const Path& first, const Path& second);
+    static bool sameContents(
+        const CompressedAsset& asset,
+        const Path& filepath
+    );
+    static CompressedAsset compressPixels(const sf::Image& image);
+    static CompressedAsset compressAsset(
+        const UData& raw,
+        AssetType type,
+        const Encoding& encoding
+    );
+    static CompressedAsset loadAsset(
+        const Path& filepath,
+        const Encoding& encoding
+    );
+    static UData decompressAsset(const CompressedAsset& asset);
+    static size_t decodedSize(const CompressedAsset& asset);
+    static std::string cacheKey(
+        const std::string& key,
+        const CompressedAsset& asset
+    );
+
+    void unpackV1(std::istream& in);
+    void unpackV2(std::istream& in);
+    void checkAsset(
+        const std::string& key,
+        const CompressedAsset& asset
+    ) const;
+
+    template <typename T>
+    std::shared_ptr<T> getCached(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return (m_cache.get<T>(key));
+    }
+
+    void cache(const std::string& key, AssetsCache::Asset asset, size_t cost);
+    void uncache(const std::string& key, const CompressedAsset& asset);
 
 public:
     static std::string formatSize(size_t size);
@@ -123,12 +248,39 @@ public:
     std::optional<SoundPtr> getSound(const std::string& key);
     std::optional<FontPtr> getFont(const std::string& key);
     std::optional<DataPtr> getData(const std::string& key);
+    std::optional<MusicPtr> getMusic(const std::string& key);
+    std::unique_ptr<AssetStream> openStream(const std::string& key) const;
+    std::optional<AtlasRegion> getRegion(const std::string& key) const;
+
+    void extract(const std::string& key, const Path& filepath);
+    size_t extractAll(const Path& directory, size_t threads = 0);
 
     void addAsset(const std::string& key, const Path& filepath);
+    size_t addAssets(
+        const std::vector<std::pair<std::string, Path>>& entries,
+        size_t threads = 0
+    );
+    size_t addDirectory(const Path& directory, size_t threads = 0);
+    Update updateDirectory(const Path& directory, size_t threads = 0);
+    void trainDictionaries(
+        size_t capacity = Compressor::DEFAULT_DICTIONARY_SIZE
+    );
+    void bakeAtlases(Uint32 pageSize = DEFAULT_ATLAS_SIZE, Uint32 padding = 1);
 
     std::unordered_map<std::string, CompressedAsset> getAssets(void) const;
+    std::vector<std::string> verify(void) const;
 
     void clear(void);
+
+    void setEncoding(const Encoding& encoding);
+    Encoding getEncoding(void) const;
+
+    void setVerification(Verification verification);
+    Verification getVerification(void) const;
+
+    void setCacheBudget(size_t budget);
+    AssetsCache::Stats getCacheStats(void) const;
+    void clearCache(void);
 };
 
 std::ostream& operator<<(std::ostream& os, const AssetsPacker& packer);
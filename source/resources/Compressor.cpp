@@ -28,7 +28,16 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "resources/Compressor.hpp"
+#include <lz4.h>
+#include <lz4hc.h>
+#include <zstd.h>
+#include <zdict.h>
 #include <iostream>
+#include <stdexcept>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -37,40 +46,420 @@ namespace tkd
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-UData Compressor::compress(const UData& data, int level)
+UData Compressor::compress(
+    const UByte* data,
+    size_t size,
+    Codec codec,
+    int level
+)
 {
-    uLong maxSize = compressBound(data.size());
-    UData cdata(maxSize);
-    uLong csize = maxSize;
+    switch (codec) {
+        case Codec::Stored:
+            return (UData(data, data + size));
+        case Codec::Zlib:
+        {
+            uLong csize = compressBound(size);
+            UData cdata(csize);
 
-    int result = compress2(
-        cdata.data(),
-        &csize,
-        data.data(),
-        data.size(),
-        level
+            if (compress2(cdata.data(), &csize, data, size, level) != Z_OK)
+                throw std::runtime_error("Compression failed");
+            cdata.resize(csize);
+            return (cdata);
+        }
+        case Codec::LZ4:
+        {
+            if (size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+                throw std::runtime_error("Compression failed");
+
+            int srcSize = static_cast<int>(size);
+            UData cdata(LZ4_compressBound(srcSize));
+            const char* src = reinterpret_cast<const char*>(data);
+            char* dst = reinterpret_cast<char*>(cdata.data());
+            int csize = level > 0
+                ? LZ4_compress_HC(src, dst, srcSize, cdata.size(), level)
+                : LZ4_compress_default(src, dst, srcSize, cdata.size());
+
+            if (csize <= 0 && srcSize > 0)
+                throw std::runtime_error("Compression failed");
+            cdata.resize(csize);
+            return (cdata);
+        }
+        case Codec::Zstd:
+        {
+            UData cdata(ZSTD_compressBound(size));
+            size_t csize = ZSTD_compress(
+                cdata.data(), cdata.size(),
+                data, size,
+                level
+            );
+
+            if (ZSTD_isError(csize))
+                throw std::runtime_error("Compression failed");
+            cdata.resize(csize);
+            return (cdata);
+        }
+    }
+    throw std::runtime_error("Unknown compression codec");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Compressor::decompress(
+    const UByte* cdata,
+    size_t csize,
+    UByte* data,
+    size_t size,
+    Codec codec
+)
+{
+    switch (codec) {
+        case Codec::Stored:
+        {
+            if (csize != size)
+                throw std::runtime_error("Decompression failed");
+            std::memcpy(data, cdata, size);
+            return;
+        }
+        case Codec::Zlib:
+        {
+            uLong dsize = size;
+            int result = uncompress(data, &dsize, cdata, csize);
+
+            if (result != Z_OK || dsize != size)
+                throw std::runtime_error("Decompression failed");
+            return;
+        }
+        case Codec::LZ4:
+        {
+            if (size > static_cast<size_t>(INT_MAX))
+                throw std::runtime_error("Decompression failed");
+
+            int dsize = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(cdata),
+                reinterpret_cast<char*>(data),
+                static_cast<int>(csize),
+                static_cast<int>(size)
+            );
+
+            if (dsize < 0 || static_cast<size_t>(dsize) != size)
+                throw std::runtime_error("Decompression failed");
+            return;
+        }
+        case Codec::Zstd:
+        {
+            size_t dsize = ZSTD_decompress(data, size, cdata, csize);
+
+            if (ZSTD_isError(dsize) || dsize != size)
+                throw std::runtime_error("Decompression failed");
+            return;
+        }
+    }
+    throw std::runtime_error("Unknown compression codec");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::compress(const UData& data, Codec codec, int level)
+{
+    return (compress(data.data(), data.size(), codec, level));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::decompress(const UData& cdata, size_t size, Codec codec)
+{
+    UData data(size);
+
+    decompress(cdata.data(), cdata.size(), data.data(), size, codec);
+    return (data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::compressAuto(const UData& data, double budget, Codec& codec)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const Codec CANDIDATES[] = {Codec::LZ4, Codec::Zstd, Codec::Zlib};
+    static const int MIN_RUNS = 3;
+    static const auto MIN_DURATION = std::chrono::milliseconds(2);
+
+    double megabytes = static_cast<double>(data.size()) / (1024.0 * 1024.0);
+    UData best = data;
+    codec = Codec::Stored;
+
+    for (Codec candidate : CANDIDATES) {
+        UData cdata = compress(data, candidate, defaultLevel(candidate));
+        if (cdata.size() >= best.size())
+            continue;
+
+        // Repeat the decode so tiny assets still give a usable measure
+        int runs = 0;
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed;
+        do {
+            decompress(cdata, data.size(), candidate);
+            runs++;
+            elapsed = Clock::now() - start;
+        } while (runs < MIN_RUNS || elapsed < MIN_DURATION);
+
+        double milliseconds = std::chrono::duration<double, std::milli>(
+            elapsed
+        ).count() / runs;
+        if (megabytes > 0.0 && milliseconds / megabytes > budget)
+            continue;
+
+        best = std::move(cdata);
+        codec = candidate;
+    }
+    return (best);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::compressChunked(
+    std::istream& in,
+    Uint64 size,
+    Codec codec,
+    int level,
+    Uint32 blockSize
+)
+{
+    if (blockSize == 0)
+        throw std::runtime_error("Invalid block size");
+
+    Uint32 count = static_cast<Uint32>((size + blockSize - 1) / blockSize);
+    std::vector<Uint64> offsets(count + 1, 0);
+    size_t header = sizeof(blockSize) + sizeof(count) +
+        offsets.size() * sizeof(Uint64);
+    UData cdata(header);
+    UData block(blockSize);
+
+    for (Uint32 i = 0; i < count; i++) {
+        Uint64 start = static_cast<Uint64>(i) * blockSize;
+        size_t length = std::min<Uint64>(blockSize, size - start);
+
+        in.read(reinterpret_cast<char*>(block.data()), length);
+        if (static_cast<size_t>(in.gcount()) != length)
+            throw std::runtime_error("Compression failed");
+
+        UData compressed = compress(block.data(), length, codec, level);
+        offsets[i] = cdata.size() - header;
+        cdata.insert(cdata.end(), compressed.begin(), compressed.end());
+    }
+    offsets[count] = cdata.size() - header;
+
+    UByte* out = cdata.data();
+    std::memcpy(out, &blockSize, sizeof(blockSize));
+    std::memcpy(out + sizeof(blockSize), &count, sizeof(count));
+    std::memcpy(
+        out + sizeof(blockSize) + sizeof(count),
+        offsets.data(),
+        offsets.size() * sizeof(Uint64)
     );
-    if (result != Z_OK)
+    return (cdata);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::decompressChunked(
+    const UData& cdata,
+    size_t size,
+    Codec codec
+)
+{
+    BlockTable table = readBlockTable(cdata, size);
+    UData data(size);
+
+    for (size_t i = 0; i + 1 < table.offsets.size(); i++) {
+        decompressBlock(
+            cdata, table, i, size, codec,
+            data.data() + i * table.blockSize
+        );
+    }
+    return (data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Compressor::BlockTable Compressor::readBlockTable(
+    const UData& cdata,
+    size_t size
+)
+{
+    BlockTable table{0, {}, 0};
+    Uint32 count = 0;
+
+    if (cdata.size() < sizeof(table.blockSize) + sizeof(count))
+        throw std::runtime_error("Invalid block table");
+    std::memcpy(&table.blockSize, cdata.data(), sizeof(table.blockSize));
+    std::memcpy(&count, cdata.data() + sizeof(table.blockSize), sizeof(count));
+
+    table.payload = sizeof(table.blockSize) + sizeof(count) +
+        (static_cast<size_t>(count) + 1) * sizeof(Uint64);
+    if (
+        table.blockSize == 0 || table.payload > cdata.size() ||
+        count != (size + table.blockSize - 1) / table.blockSize
+    ) throw std::runtime_error("Invalid block table");
+
+    table.offsets.resize(static_cast<size_t>(count) + 1);
+    std::memcpy(
+        table.offsets.data(),
+        cdata.data() + sizeof(table.blockSize) + sizeof(count),
+        table.offsets.size() * sizeof(Uint64)
+    );
+
+    for (size_t i = 0; i < count; i++) {
+        if (table.offsets[i] > table.offsets[i + 1])
+            throw std::runtime_error("Invalid block table");
+    }
+    if (table.offsets[count] != cdata.size() - table.payload)
+        throw std::runtime_error("Invalid block table");
+    return (table);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Compressor::decompressBlock(
+    const UData& cdata,
+    const BlockTable& table,
+    size_t index,
+    size_t size,
+    Codec codec,
+    UByte* data
+)
+{
+    size_t start = index * table.blockSize;
+    size_t length = std::min<size_t>(table.blockSize, size - start);
+
+    decompress(
+        cdata.data() + table.payload + table.offsets[index],
+        table.offsets[index + 1] - table.offsets[index],
+        data,
+        length,
+        codec
+    );
+    return (length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Compressor::Dictionary::Dictionary(UData content)
+    : m_content(std::move(content))
+    , m_digest(
+        ZSTD_createDDict(m_content.data(), m_content.size()),
+        ZSTD_freeDDict
+    )
+{
+    if (!m_digest)
+        throw std::runtime_error("Invalid compression dictionary");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const UData& Compressor::Dictionary::getContent(void) const
+{
+    return (m_content);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<const Compressor::Dictionary> Compressor::trainDictionary(
+    const std::vector<UData>& samples,
+    size_t capacity
+)
+{
+    // The trainer expects the samples back to back with their sizes aside
+    UData buffer;
+    std::vector<size_t> sizes;
+    sizes.reserve(samples.size());
+    for (const UData& sample : samples) {
+        buffer.insert(buffer.end(), sample.begin(), sample.end());
+        sizes.push_back(sample.size());
+    }
+
+    UData content(capacity);
+    size_t size = ZDICT_trainFromBuffer(
+        content.data(), content.size(),
+        buffer.data(), sizes.data(), static_cast<unsigned>(sizes.size())
+    );
+    if (ZDICT_isError(size))
+        return (nullptr);
+
+    content.resize(size);
+    return (std::make_shared<const Dictionary>(std::move(content)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UData Compressor::compress(
+    const UData& data,
+    const Dictionary& dictionary,
+    int level
+)
+{
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(
+        ZSTD_createCCtx(), ZSTD_freeCCtx
+    );
+    if (!context)
         throw std::runtime_error("Compression failed");
+
+    UData cdata(ZSTD_compressBound(data.size()));
+    size_t csize = ZSTD_compress_usingDict(
+        context.get(), cdata.data(), cdata.size(), data.data(), data.size(),
+        dictionary.m_content.data(), dictionary.m_content.size(), level
+    );
+    if (ZSTD_isError(csize))
+        throw std::runtime_error("Compression failed");
+
     cdata.resize(csize);
     return (cdata);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-UData Compressor::decompress(const UData& cdata, uLong size)
+UData Compressor::decompress(
+    const UData& cdata,
+    size_t size,
+    const Dictionary& dictionary
+)
 {
-    UData data(size);
-    uLong dsize = size;
+    // Small assets are decoded often, each thread keeps its context
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(
+        ZSTD_createDCtx(), ZSTD_freeDCtx
+    );
+    if (!context)
+        throw std::runtime_error("Decompression failed");
 
-    int result = uncompress(
-        data.data(),
-        &dsize,
-        cdata.data(),
-        cdata.size()
+    UData data(size);
+    size_t dsize = ZSTD_decompress_usingDDict(
+        context.get(), data.data(), size, cdata.data(), cdata.size(),
+        dictionary.m_digest.get()
     );
-    if (result != Z_OK)
+    if (ZSTD_isError(dsize) || dsize != size)
         throw std::runtime_error("Decompression failed");
+
     return (data);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int Compressor::defaultLevel(Codec codec)
+{
+    switch (codec) {
+        case Codec::Zlib:   return (Z_DEFAULT_COMPRESSION);
+        case Codec::LZ4:    return (LZ4HC_CLEVEL_DEFAULT);
+        case Codec::Zstd:   return (ZSTD_CLEVEL_DEFAULT);
+        default:            return (0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Compressor::getName(Codec codec)
+{
+    switch (codec) {
+        case Codec::Stored: return ("stored");
+        case Codec::Zlib:   return ("zlib");
+        case Codec::LZ4:    return ("lz4");
+        case Codec::Zstd:   return ("zstd");
+    }
+    return ("unknown");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<Compressor::Codec> Compressor::fromName(const std::string& name)
+{
+    for (Codec codec : {Codec::Stored, Codec::Zlib, Codec::LZ4, Codec::Zstd}) {
+        if (getName(codec) == name)
+            return (codec);
+    }
+    return (std::nullopt);
+}
+
 } // namespace tkd
@@ -34,6 +34,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "utils/Types.hpp"
 #include <zlib.h>
+#include <string>
+#include <optional>
+#include <istream>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+///////////////////////////////////////////////////////////////////////////////
+struct ZSTD_DDict_s;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd
@@ -49,29 +59,312 @@ class Compressor
 {
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Compress data using ZLIB
+    /// \brief Available compression codecs, stored as is in asset packs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Codec : Uint8
+    {
+        Stored,         //<! No compression
+        Zlib,           //<! Deflate, balanced
+        LZ4,            //<! Fastest decode, lower ratio
+        Zstd            //<! Best ratio, fast decode
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Layout of a chunked blob
+    ///
+    /// A chunked blob starts with the block size, the block count and the
+    /// offset of every block, so each block can be decoded on its own.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct BlockTable
+    {
+        Uint32 blockSize;               //<! The original size of a block
+        std::vector<Uint64> offsets;    //<! Block offsets, plus the end
+        size_t payload;                 //<! Offset of the first block
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Zstd dictionary shared by a family of small assets
+    ///
+    /// The digested form used to decompress is built once, it is read only
+    /// and may be used by several threads at once.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Dictionary
+    {
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Private properties
+        ///////////////////////////////////////////////////////////////////////
+        UData m_content;                        //<! The raw dictionary
+        std::shared_ptr<ZSTD_DDict_s> m_digest; //<! The decoding tables
+
+        friend class Compressor;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Create a dictionary from its raw content
+        ///
+        /// \param content The dictionary as produced by the training
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Dictionary(UData content);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get the raw content of the dictionary
+        ///
+        /// \return The content to store in asset packs
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        const UData& getContent(void) const;
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default original size of the blocks of a chunked blob
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Default maximum decode time, in milliseconds per Mo, when the codec is
+    // selected automatically
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr double DEFAULT_DECODE_BUDGET = 1.5;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Default maximum size of a trained dictionary
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t DEFAULT_DICTIONARY_SIZE = 32 * 1024;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compress a memory range with the given codec
     ///
     /// \param data The data to compress
-    /// \param level The compression level
+    /// \param size The size of the data
+    /// \param codec The codec to use
+    /// \param level The codec specific level
+    ///
+    /// \return The compressed data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData compress(
+        const UByte* data,
+        size_t size,
+        Codec codec,
+        int level
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress a memory range into a caller provided buffer
+    ///
+    /// \param cdata The compressed data
+    /// \param csize The size of the compressed data
+    /// \param data The output buffer
+    /// \param size The original size, which must fill the whole buffer
+    /// \param codec The codec used to compress the data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void decompress(
+        const UByte* cdata,
+        size_t csize,
+        UByte* data,
+        size_t size,
+        Codec codec
+    );
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compress data with the given codec
+    ///
+    /// \param data The data to compress
+    /// \param codec The codec to use
+    /// \param level The codec specific level, see `defaultLevel`
+    ///
+    /// \return The compressed data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData compress(const UData& data, Codec codec, int level);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress data compressed with the given codec
+    ///
+    /// \param cdata The compressed data
+    /// \param size The original data size
+    /// \param codec The codec used to compress the data
+    ///
+    /// \return The decompressed data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData decompress(const UData& cdata, size_t size, Codec codec);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compress data with the codec giving the smallest output whose
+    /// decode time stays within a budget
+    ///
+    /// Every codec is tried at its default level and decoded a few times to
+    /// measure its speed. Storing the data always fits in the budget.
+    ///
+    /// \param data The data to compress
+    /// \param budget The maximum decode time, in milliseconds per Mo
+    /// \param codec Set to the selected codec
+    ///
+    /// \return The compressed data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData compressAuto(const UData& data, double budget, Codec& codec);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compress a stream into independently decodable blocks
+    ///
+    /// Only one block of the source is held in memory at a time.
+    ///
+    /// \param in The stream to read the data from
+    /// \param size The number of bytes to read from the stream
+    /// \param codec The codec to use for every block
+    /// \param level The codec specific level
+    /// \param blockSize The original size of a block
+    ///
+    /// \return The chunked blob
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData compressChunked(
+        std::istream& in,
+        Uint64 size,
+        Codec codec,
+        int level,
+        Uint32 blockSize = DEFAULT_BLOCK_SIZE
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress every block of a chunked blob
+    ///
+    /// \param cdata The chunked blob
+    /// \param size The original data size
+    /// \param codec The codec used to compress the blocks
+    ///
+    /// \return The decompressed data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static UData decompressChunked(
+        const UData& cdata,
+        size_t size,
+        Codec codec
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read and validate the block table of a chunked blob
+    ///
+    /// \param cdata The chunked blob
+    /// \param size The original data size
+    ///
+    /// \return The block table
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static BlockTable readBlockTable(const UData& cdata, size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompress a single block of a chunked blob
+    ///
+    /// \param cdata The chunked blob
+    /// \param table The block table of the blob
+    /// \param index The index of the block
+    /// \param size The original data size
+    /// \param codec The codec used to compress the blocks
+    /// \param data The output buffer, at least one block long
+    ///
+    /// \return The original size of the block
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t decompressBlock(
+        const UData& cdata,
+        const BlockTable& table,
+        size_t index,
+        size_t size,
+        Codec codec,
+        UByte* data
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Train a zstd dictionary on a family of similar samples
+    ///
+    /// \param samples The original data of the samples
+    /// \param capacity The maximum size of the dictionary
+    ///
+    /// \return The dictionary, or null if the samples are too few or too
+    /// small to learn from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::shared_ptr<const Dictionary> trainDictionary(
+        const std::vector<UData>& samples,
+        size_t capacity = DEFAULT_DICTIONARY_SIZE
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compress data with zstd and a dictionary
+    ///
+    /// \param data The data to compress
+    /// \param dictionary The dictionary to use
+    /// \param level The zstd level
     ///
     /// \return The compressed data
     ///
     ///////////////////////////////////////////////////////////////////////////
     static UData compress(
         const UData& data,
-        int level = Z_DEFAULT_COMPRESSION
+        const Dictionary& dictionary,
+        int level
     );
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Decompress data compressed with ZLIB
+    /// \brief Decompress data compressed with zstd and a dictionary
     ///
-    /// \param data The compressed data
+    /// \param cdata The compressed data
     /// \param size The original data size
+    /// \param dictionary The dictionary used to compress the data
     ///
     /// \return The decompressed data
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static UData decompress(const UData& cdata, uLong size);
+    static UData decompress(
+        const UData& cdata,
+        size_t size,
+        const Dictionary& dictionary
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the default level of a codec
+    ///
+    /// Defaults balance the ratio against the packing time, the slow high
+    /// levels of zstd must be asked for explicitly.
+    ///
+    /// \param codec The codec
+    ///
+    /// \return The level used when none is given
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static int defaultLevel(Codec codec);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the display name of a codec
+    ///
+    /// \param codec The codec
+    ///
+    /// \return The lowercase name of the codec
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string getName(Codec codec);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find a codec from its display name
+    ///
+    /// \param name The lowercase name of the codec
+    ///
+    /// \return The codec if the name is known
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::optional<Codec> fromName(const std::string& name);
 };
 
 } // namespace tkd
@@ -89,10 +89,12 @@ void Discovery::update(float deltaT)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Discovery::render(void)
+void Discovery::render(float alpha)
 {
     Uint32 idx = 0;
 
+    IGNORE(alpha);
+
     for (auto [address, port] : m_servers) {
         m_shape.setPosition({400, 50 + 75 * (float)idx});
         m_window->draw(m_shape);
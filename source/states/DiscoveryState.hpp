@@ -76,7 +76,7 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
-    void render(void) override;
+    void render(float alpha) override;
 };
 
 } // namespace tkd::States
@@ -35,6 +35,8 @@
 #include "states/StateManager.hpp"
 #include "network/Packet.hpp"
 #include "network/Client.hpp"
+#include "resources/AssetsLoader.hpp"
+#include "utils/JobSystem.hpp"
 #include <SFML/Graphics.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -62,6 +64,8 @@ protected:
     StateManager* m_manager;        //<! Pointer to the state manager
     Client* m_client;               //<! Pointer to the client
     bool* m_debug;                  //<! Pointer to the debug state
+    AssetsLoader* m_loader;         //<! Pointer to the assets loader
+    JobSystem* m_jobs;              //<! Pointer to the update job system
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -96,7 +100,9 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the game state
     ///
-    /// \param deltaT The current delta time
+    /// Called at a fixed rate, possibly several times per frame.
+    ///
+    /// \param deltaT The fixed delta time of a step
     ///
     ///////////////////////////////////////////////////////////////////////////
     virtual void update(float deltaT) = 0;
@@ -104,8 +110,10 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Render the game state
     ///
+    /// \param alpha The time since the last update, as a fraction of a step
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    virtual void render(void) = 0;
+    virtual void render(float alpha) = 0;
 
 public:
     ///////////////////////////////////////////////////////////////////////////
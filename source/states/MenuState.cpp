@@ -79,8 +79,9 @@ void Menu::update(float deltaT)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Menu::render(void)
+void Menu::render(float alpha)
 {
+    IGNORE(alpha);
     m_window->draw(m_button);
 }
 
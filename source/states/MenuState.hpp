@@ -71,7 +71,7 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
-    void render(void) override;
+    void render(float alpha) override;
 };
 
 } // namespace tkd::States
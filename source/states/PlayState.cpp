@@ -31,6 +31,9 @@
 #include "utils/Macros.hpp"
 #include "states/MenuState.hpp"
 #include "imgui/imgui.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace tkd::States
@@ -40,7 +43,13 @@ namespace tkd::States
 
 ///////////////////////////////////////////////////////////////////////////////
 void Play::init(void)
-{}
+{
+    m_camera = m_window->getDefaultView();
+    m_collisions.add(&m_player);
+    m_playerSprite = m_loader->loadSprite(Player::SPRITE_KEY);
+
+    m_roomData = m_loader->loadData(Room::DEFAULT_KEY);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 void Play::handleEvent(sf::Event event)
@@ -72,8 +81,7 @@ void Play::handlePacket(Packet packet)
             for (size_t i = 0; i < size; i++) {
                 int id = -1; Vec2f pos;
                 packet >> id >> pos;
-                m_enemies[id] = std::make_unique<Player>();
-                m_enemies[id]->setPosition(pos);
+                spawnEnemy(id, pos);
             }
             break;
         }
@@ -81,14 +89,15 @@ void Play::handlePacket(Packet packet)
         {
             int id = -1; Vec2f pos;
             packet >> id >> pos;
-            m_enemies[id] = std::make_unique<Player>();
-            m_enemies[id]->setPosition(pos);
+            spawnEnemy(id, pos);
             break;
         }
         case Packet::Type::PlayerLeft:
         {
             int id = -1;
             packet >> id;
+            if (m_enemies.count(id))
+                m_collisions.remove(m_enemies[id].get());
             m_enemies.erase(id);
             break;
         }
@@ -118,6 +127,8 @@ void Play::update(float deltaT)
         return;
     }
 
+    pollRoom();
+
     static const float MOVE_FORCE = 50000.f;
     static const float JUMP_FORCE = 6000.f;
 
@@ -140,15 +151,117 @@ void Play::update(float deltaT)
     m_player.updatePhysics(deltaT, m_room);
     for (const auto& [id, enemy] : m_enemies)
         enemy->update(deltaT);
+    m_collisions.update();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Play::spawnEnemy(int id, const Vec2f& position)
+{
+    if (m_enemies.count(id))
+        m_collisions.remove(m_enemies[id].get());
+
+    m_enemies[id] = std::make_unique<Player>();
+    m_enemies[id]->setPosition(position);
+    m_collisions.add(m_enemies[id].get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Play::pollRoom(void)
+{
+    if (!m_roomData.valid())
+        return;
+    if (
+        m_roomData.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready
+    )
+        return;
+
+    // Moving the future out leaves it invalid, so the room is swapped once
+    AssetsLoader::Future<UData> future = std::move(m_roomData);
+    try {
+        auto data = future.get();
+        if (!data)
+            return;
+        m_room = Room(TileMap::load(*data));
+        m_roomRenderer.invalidate();
+    } catch (const std::exception& error) {
+        std::cerr << "Cannot load room: " << error.what() << std::endl;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Play::render(void)
+void Play::updateCamera(float alpha)
 {
-    m_room.render(*m_window);
-    m_player.render(*m_window);
+    sf::Vector2f size = m_camera.getSize();
+    Vec2f focus = m_player.getInterpolatedPosition(alpha);
+    if (const Collider* collider = m_player.getCollider())
+        focus += collider->getDimension() * .5f;
+    sf::Vector2f center(focus.x, focus.y);
+
+    // Rooms smaller than the view stay centered on that axis
+    const TileMap& map = m_room.getMap();
+    sf::Vector2f room(
+        map.getWidth() * map.getTileSize(),
+        map.getHeight() * map.getTileSize()
+    );
+    center.x = room.x <= size.x
+        ? room.x * .5f
+        : std::clamp(center.x, size.x * .5f, room.x - size.x * .5f);
+    center.y = room.y <= size.y
+        ? room.y * .5f
+        : std::clamp(center.y, size.y * .5f, room.y - size.y * .5f);
+    m_camera.setCenter(center);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Play::isVisible(const Entity& entity) const
+{
+    const Collider* collider = entity.getCollider();
+    if (!collider)
+        return (true);
+
+    sf::Vector2f size = m_camera.getSize();
+    sf::Vector2f corner = m_camera.getCenter() - size * .5f;
+    return (*collider | Collider(
+        Vec2f(corner.x, corner.y), Vec2f(size.x, size.y)
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Play::renderPlayers(float alpha)
+{
+    using Status = AssetsLoader::TextureRequest::Status;
+    const auto& sprite = m_playerSprite;
+    const sf::Texture* texture = sprite.texture &&
+        sprite.texture->status == Status::Ready
+        ? sprite.texture->texture.get() : nullptr;
+
+    auto draw = [&](Player& player){
+        if (!isVisible(player))
+            return;
+        if (texture)
+            player.render(m_sprites, *texture, sprite.rect, alpha);
+        else
+            player.render(*m_window, alpha);
+    };
+
+    m_sprites.clear();
+    draw(m_player);
     for (const auto& [id, enemy] : m_enemies)
-        enemy->render(*m_window);
+        draw(*enemy);
+    m_sprites.render(*m_window);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Play::render(float alpha)
+{
+    updateCamera(alpha);
+    m_window->setView(m_camera);
+
+    m_roomRenderer.render(*m_window, m_room);
+    renderPlayers(alpha);
+
+    m_window->setView(m_window->getDefaultView());
 }
 
 } // namespace tkd::States
@@ -34,7 +34,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "GameState.hpp"
 #include "game/Room.hpp"
+#include "game/RoomRenderer.hpp"
 #include "game/Player.hpp"
+#include "game/EntityCollisions.hpp"
+#include "core/SpriteBatch.hpp"
 #include <map>
 #include <memory>
 
@@ -58,6 +61,61 @@ private:
     Player m_player;
     std::map<int, std::unique_ptr<Player>> m_enemies;
     Room m_room;
+    RoomRenderer m_roomRenderer;
+    sf::View m_camera;
+    EntityCollisions m_collisions;
+    SpriteBatch m_sprites;
+    AssetsLoader::SpriteHandle m_playerSprite;
+    AssetsLoader::Future<UData> m_roomData;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create or replace a remote player
+    ///
+    /// \param id The network id of the player
+    /// \param position The position of the player
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void spawnEnemy(int id, const Vec2f& position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Swap in the room of the pack once the loader has read it
+    ///
+    /// The built-in room is played until then, or for good when the pack
+    /// has no room or the room cannot be parsed.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pollRoom(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Center the camera on the player, kept inside the room
+    ///
+    /// \param alpha The time since the last update, as a fraction of a step
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void updateCamera(float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if an entity is inside the camera
+    ///
+    /// \param entity The entity to check
+    ///
+    /// \return True if the entity collider overlaps the camera
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool isVisible(const Entity& entity) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw the visible players
+    ///
+    /// Once the player sprite is uploaded, every player is drawn from it
+    /// through the sprite batch, in one draw call. Until then, or without
+    /// the sprite in the pack, each player draws its own shape.
+    ///
+    /// \param alpha The time since the last update, as a fraction of a step
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void renderPlayers(float alpha);
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -78,7 +136,7 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
-    void render(void) override;
+    void render(float alpha) override;
 };
 
 } // namespace tkd::States
@@ -39,11 +39,15 @@ namespace tkd
 StateManager::StateManager(
     sf::RenderWindow& window,
     Client* client,
-    bool* debug
+    bool* debug,
+    AssetsLoader* loader,
+    JobSystem* jobs
 )
     : m_window(window)
     , m_client(client)
     , m_debug(debug)
+    , m_loader(loader)
+    , m_jobs(jobs)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -55,6 +59,8 @@ void StateManager::push(State state)
     state->m_window = &m_window;
     state->m_client = m_client;
     state->m_debug = m_debug;
+    state->m_loader = m_loader;
+    state->m_jobs = m_jobs;
     state->init();
     m_states.push(std::move(state));
 }
@@ -95,10 +101,10 @@ void StateManager::update(float deltaT)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void StateManager::render(void)
+void StateManager::render(float alpha)
 {
     if (!m_states.empty())
-        m_states.top()->render();
+        m_states.top()->render(alpha);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 #include "states/GameState.hpp"
 #include "network/Client.hpp"
 #include "network/Packet.hpp"
+#include "resources/AssetsLoader.hpp"
+#include "utils/JobSystem.hpp"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <stack>
@@ -70,6 +72,8 @@ private:
     sf::RenderWindow& m_window;     //<! The rendering window
     Client* m_client;               //<! Reference to the client
     bool* m_debug;                  //<! Pointer to the debug mode
+    AssetsLoader* m_loader;         //<! Pointer to the assets loader
+    JobSystem* m_jobs;              //<! Pointer to the update job system
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -78,9 +82,17 @@ public:
     /// \param window The window to link the manager to
     /// \param client The client reference
     /// \param debug The debug pointer
+    /// \param loader The assets loader
+    /// \param jobs The job system shared by the states
     ///
     ///////////////////////////////////////////////////////////////////////////
-    StateManager(sf::RenderWindow& window, Client* client, bool* debug);
+    StateManager(
+        sf::RenderWindow& window,
+        Client* client,
+        bool* debug,
+        AssetsLoader* loader,
+        JobSystem* jobs
+    );
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -132,8 +144,10 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Render the game using the top state
     ///
+    /// \param alpha The time since the last update, as a fraction of a step
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void render(void);
+    void render(float alpha);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Check if the state manager is empty
@@ -60,10 +60,10 @@ void Test::update(float deltaT)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Test::render(void)
+void Test::render(float alpha)
 {
-    m_room.render(*m_window);
-    m_player.render(*m_window);
+    m_roomRenderer.render(*m_window, m_room);
+    m_player.render(*m_window, alpha);
 }
 
 } // namespace tkd::States
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "GameState.hpp"
 #include "game/Room.hpp"
+#include "game/RoomRenderer.hpp"
 #include "game/Player.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +54,7 @@ private:
     // Private properties
     ///////////////////////////////////////////////////////////////////////////
     Room m_room;
+    RoomRenderer m_roomRenderer;
     Player m_player;
 
 public:
@@ -74,7 +76,7 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////
-    void render(void) override;
+    void render(float alpha) override;
 };
 
 } // namespace tkd::States
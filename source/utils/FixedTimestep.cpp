@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/FixedTimestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+FixedTimestep::FixedTimestep(float step, Uint32 maxSteps)
+    : m_step(step)
+    , m_maxSteps(std::max<Uint32>(maxSteps, 1))
+    , m_accumulator(0.0)
+    , m_tick(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 FixedTimestep::advance(float elapsed)
+{
+    m_accumulator += std::max(elapsed, 0.f);
+
+    double steps = std::floor(m_accumulator / m_step);
+    if (steps > m_maxSteps) {
+        // Too far behind, the late time is dropped instead of caught up
+        m_accumulator = std::fmod(m_accumulator, m_step);
+        steps = m_maxSteps;
+    } else {
+        m_accumulator -= steps * m_step;
+    }
+
+    m_tick += static_cast<Uint64>(steps);
+    return (static_cast<Uint32>(steps));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float FixedTimestep::getAlpha(void) const
+{
+    return (std::clamp(static_cast<float>(m_accumulator / m_step), 0.f, 1.f));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float FixedTimestep::getStep(void) const
+{
+    return (m_step);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 FixedTimestep::getTick(void) const
+{
+    return (m_tick);
+}
+
+} // namespace tkd
@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Accumulator turning variable frame times into fixed steps
+///
+/// The simulation always advances by the same delta, so it gives the same
+/// results whatever the frame rate, on the client and on the server. The
+/// time left between two steps is exposed as a blend factor for rendering.
+/// When a frame takes too long, the number of steps is capped and the late
+/// time is dropped, so a slow machine slows down instead of spiralling.
+///
+///////////////////////////////////////////////////////////////////////////////
+class FixedTimestep
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Default simulation rate, shared by the client and the server
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float DEFAULT_STEP = 1.f / 60.f;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Default maximum number of steps run for a single frame
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 DEFAULT_MAX_STEPS = 5;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    float m_step;               //<! The duration of a step in seconds
+    Uint32 m_maxSteps;          //<! The maximum steps per advance
+    double m_accumulator;       //<! The time not simulated yet
+    Uint64 m_tick;              //<! The number of steps run so far
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default timestep constructor
+    ///
+    /// \param step The duration of a step in seconds
+    /// \param maxSteps The maximum number of steps per advance
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FixedTimestep(
+        float step = DEFAULT_STEP,
+        Uint32 maxSteps = DEFAULT_MAX_STEPS
+    );
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add elapsed time and get the number of steps to run
+    ///
+    /// \param elapsed The time elapsed since the last advance in seconds
+    ///
+    /// \return The number of steps of getStep() seconds to simulate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 advance(float elapsed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the fraction of a step not simulated yet
+    ///
+    /// \return The blend factor between the two last states, in [0, 1)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float getAlpha(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the duration of a step
+    ///
+    /// \return The duration of a step in seconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float getStep(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of steps run since the start
+    ///
+    /// \return The current tick
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 getTick(void) const;
+};
+
+} // namespace tkd
@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Hash.hpp"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <array>
+#include <vector>
+
+#if defined(__x86_64__)
+    #include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Reflected Castagnoli polynomial
+///////////////////////////////////////////////////////////////////////////////
+static constexpr Uint32 CRC32C_POLYNOMIAL = 0x82F63B78;
+
+///////////////////////////////////////////////////////////////////////////////
+static constexpr std::array<Uint32, 256> makeCrc32cTable(void)
+{
+    std::array<Uint32, 256> table{};
+
+    for (Uint32 i = 0; i < 256; i++) {
+        Uint32 crc = i;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLYNOMIAL : 0);
+        table[i] = crc;
+    }
+    return (table);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static Uint32 crc32cTable(const UByte* data, size_t size, Uint32 crc)
+{
+    static constexpr std::array<Uint32, 256> table = makeCrc32cTable();
+
+    for (size_t i = 0; i < size; i++)
+        crc = (crc >> 8) ^ table[(crc ^ data[i]) & 0xFF];
+    return (crc);
+}
+
+#if defined(__x86_64__)
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("sse4.2")))
+static Uint32 crc32cHardware(const UByte* data, size_t size, Uint32 crc)
+{
+    Uint64 value = crc;
+
+    for (; size >= 8; data += 8, size -= 8) {
+        Uint64 chunk;
+        std::memcpy(&chunk, data, 8);
+        value = _mm_crc32_u64(value, chunk);
+    }
+    crc = static_cast<Uint32>(value);
+    for (; size > 0; data++, size--)
+        crc = _mm_crc32_u8(crc, *data);
+    return (crc);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool hasHardwareCrc32c(void)
+{
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return (supported);
+}
+#elif defined(__ARM_FEATURE_CRC32)
+///////////////////////////////////////////////////////////////////////////////
+static Uint32 crc32cHardware(const UByte* data, size_t size, Uint32 crc)
+{
+    for (; size >= 8; data += 8, size -= 8) {
+        Uint64 chunk;
+        std::memcpy(&chunk, data, 8);
+        crc = __crc32cd(crc, chunk);
+    }
+    for (; size > 0; data++, size--)
+        crc = __crc32cb(crc, *data);
+    return (crc);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool hasHardwareCrc32c(void)
+{
+    return (true);
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+static Uint32 crc32cHardware(const UByte* data, size_t size, Uint32 crc)
+{
+    return (crc32cTable(data, size, crc));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static bool hasHardwareCrc32c(void)
+{
+    return (false);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 Hash::fnv1a(const void* data, size_t size, Uint64 seed)
+{
+    const UByte* bytes = static_cast<const UByte*>(data);
+    Uint64 hash = seed;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 Hash::file(const std::filesystem::path& filepath)
+{
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Cannot open file: " + filepath.string());
+
+    std::vector<char> buffer(64 * 1024);
+    Uint64 hash = FNV_OFFSET;
+
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        hash = fnv1a(buffer.data(), file.gcount(), hash);
+    }
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 Hash::crc32c(const void* data, size_t size, Uint32 seed)
+{
+    const UByte* bytes = static_cast<const UByte*>(data);
+    Uint32 crc = ~seed;
+
+    if (hasHardwareCrc32c())
+        crc = crc32cHardware(bytes, size, crc);
+    else
+        crc = crc32cTable(bytes, size, crc);
+    return (~crc);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Hash::toHex(Uint64 hash)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string hex(16, '0');
+
+    for (int i = 15; i >= 0; i--, hash >>= 4)
+        hex[i] = digits[hash & 0xF];
+    return (hex);
+}
+
+} // namespace tkd
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include <filesystem>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Utility hashing class
+///
+///////////////////////////////////////////////////////////////////////////////
+class Hash
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Initial value of a FNV-1a hash
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 FNV_OFFSET = 0xCBF29CE484222325ULL;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash a memory range with 64 bits FNV-1a
+    ///
+    /// Passing the result of a previous call as the seed hashes several
+    /// ranges as if they were contiguous.
+    ///
+    /// \param data The data to hash
+    /// \param size The size of the data
+    /// \param seed The hash to continue from
+    ///
+    /// \return The hash of the data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 fnv1a(
+        const void* data,
+        size_t size,
+        Uint64 seed = FNV_OFFSET
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash the content of a file with 64 bits FNV-1a
+    ///
+    /// \param filepath The path of the file
+    ///
+    /// \return The hash of the file content
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 file(const std::filesystem::path& filepath);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compute the CRC32C (Castagnoli) checksum of a memory range
+    ///
+    /// The SSE4.2 or ARMv8 CRC instructions are used when the CPU has them,
+    /// with a table driven fallback otherwise. Passing the result of a
+    /// previous call as the seed checksums several ranges as if they were
+    /// contiguous.
+    ///
+    /// \param data The data to checksum
+    /// \param size The size of the data
+    /// \param seed The checksum to continue from
+    ///
+    /// \return The checksum of the data
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint32 crc32c(const void* data, size_t size, Uint32 seed = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Format a hash as a fixed width hexadecimal string
+    ///
+    /// \param hash The hash to format
+    ///
+    /// \return The hexadecimal representation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string toHex(Uint64 hash);
+};
+
+} // namespace tkd
@@ -0,0 +1,330 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/JobSystem.hpp"
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Ranges queued per thread by parallelFor, so fast threads take more of them
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t RANGES_PER_THREAD = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+// The system and the queue of the current worker thread
+///////////////////////////////////////////////////////////////////////////////
+static thread_local const JobSystem* t_system = nullptr;
+static thread_local size_t t_queue = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+bool JobSystem::Handle::isDone(void) const
+{
+    return (!m_job || m_job->done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+JobSystem::JobSystem(size_t threads)
+    : m_queued(0)
+    , m_next(0)
+    , m_waiting(0)
+    , m_stopping(false)
+{
+    if (threads == 0)
+        threads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+    for (size_t i = 0; i < threads; i++)
+        m_queues.push_back(std::make_unique<Queue>());
+    for (size_t i = 0; i < threads; i++)
+        m_workers.emplace_back(&JobSystem::work, this, i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobSystem::work(size_t index)
+{
+    t_system = this;
+    t_queue = index;
+
+    while (true) {
+        std::shared_ptr<Job> job = take(index);
+
+        if (job) {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this](void){
+            return (m_stopping || m_queued > 0);
+        });
+        if (m_stopping && m_queued == 0)
+            return;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<JobSystem::Job> JobSystem::take(size_t index)
+{
+    size_t count = m_queues.size();
+
+    // The newest job of the own queue is the most likely to be in cache
+    if (index < count) {
+        Queue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            std::shared_ptr<Job> job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            m_queued--;
+            return (job);
+        }
+    }
+
+    // The oldest job of a victim is the one it would run last
+    for (size_t i = 1; i <= count; i++) {
+        Queue& queue = *m_queues[(index + i) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            std::shared_ptr<Job> job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            m_queued--;
+            return (job);
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobSystem::schedule(std::shared_ptr<Job> job)
+{
+    size_t index = getCurrentQueue();
+
+    // Jobs from the outside are spread over the workers
+    if (index >= m_queues.size())
+        index = m_next++ % m_queues.size();
+
+    // Counted before it is visible, so a thief never takes the count below
+    // zero; a thread woken early only retries until the push lands
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+        m_queues[index]->jobs.push_back(std::move(job));
+    }
+    m_condition.notify_one();
+    if (m_waiting > 0)
+        m_finished.notify_all();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobSystem::execute(const std::shared_ptr<Job>& job)
+{
+    try {
+        if (job->task)
+            job->task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        if (!job->error)
+            job->error = std::current_exception();
+    }
+    job->task = nullptr;
+    release(job);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobSystem::release(std::shared_ptr<Job> job)
+{
+    if (--job->unfinished != 0)
+        return;
+
+    std::vector<std::shared_ptr<Job>> next;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->done = true;
+        next.swap(job->next);
+    }
+
+    // Taking the sleep mutex orders the wake up after the check in wait
+    if (m_waiting > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished.notify_all();
+    }
+
+    if (job->parent) {
+        if (job->error) {
+            std::lock_guard<std::mutex> lock(job->parent->mutex);
+            if (!job->parent->error)
+                job->parent->error = job->error;
+        }
+        release(job->parent);
+    }
+
+    for (auto& dependent : next) {
+        if (--dependent->waiting == 0)
+            schedule(std::move(dependent));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t JobSystem::getCurrentQueue(void) const
+{
+    return (t_system == this ? t_queue : m_queues.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+JobSystem::Handle JobSystem::enqueue(
+    std::shared_ptr<Job> job,
+    const std::vector<Handle>& dependencies
+)
+{
+    Handle handle;
+
+    handle.m_job = job;
+
+    // One extra count so the job can not start before the loop is over
+    job->waiting = 1;
+    for (const Handle& dependency : dependencies) {
+        if (!dependency.m_job)
+            continue;
+        std::lock_guard<std::mutex> lock(dependency.m_job->mutex);
+        if (dependency.m_job->done)
+            continue;
+        job->waiting++;
+        dependency.m_job->next.push_back(job);
+    }
+    if (--job->waiting == 0)
+        schedule(std::move(job));
+    return (handle);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+JobSystem::Handle JobSystem::submit(
+    std::function<void()> task,
+    const std::vector<Handle>& dependencies
+)
+{
+    auto job = std::make_shared<Job>();
+
+    job->task = std::move(task);
+    return (enqueue(std::move(job), dependencies));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+JobSystem::Handle JobSystem::parallelFor(
+    size_t count,
+    size_t grain,
+    std::function<void(size_t first, size_t last)> task,
+    const std::vector<Handle>& dependencies
+)
+{
+    grain = std::max<size_t>(grain, 1);
+
+    auto loop = std::make_shared<std::function<void(size_t, size_t)>>(
+        std::move(task)
+    );
+    size_t ranges = std::min(
+        (count + grain - 1) / grain,
+        (m_workers.size() + 1) * RANGES_PER_THREAD
+    );
+    size_t step = ranges == 0 ? 0 : (count + ranges - 1) / ranges;
+    auto job = std::make_shared<Job>();
+    Job* root = job.get();
+
+    // The ranges are only known to be ready once the loop job starts, they
+    // keep it unfinished until the last of them is done
+    job->task = [this, loop, count, step, root](void){
+        std::shared_ptr<Job> parent = root->shared_from_this();
+
+        for (size_t first = step; first < count; first += step) {
+            size_t last = std::min(first + step, count);
+            auto range = std::make_shared<Job>();
+
+            range->task = [loop, first, last](void){ (*loop)(first, last); };
+            range->parent = parent;
+            parent->unfinished++;
+            schedule(std::move(range));
+        }
+        if (count > 0)
+            (*loop)(0, std::min(step, count));
+    };
+    return (enqueue(std::move(job), dependencies));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void JobSystem::wait(const Handle& handle)
+{
+    size_t index = getCurrentQueue();
+
+    if (!handle.m_job)
+        return;
+
+    while (!handle.m_job->done) {
+        std::shared_ptr<Job> job = take(index);
+
+        if (job) {
+            execute(job);
+            continue;
+        }
+
+        // The last jobs run elsewhere, sleep until one of them is done
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiting++;
+        m_finished.wait(lock, [this, &handle](void){
+            return (handle.m_job->done || m_queued > 0);
+        });
+        m_waiting--;
+    }
+    if (handle.m_job->error)
+        std::rethrow_exception(handle.m_job->error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t JobSystem::size(void) const
+{
+    return (m_workers.size());
+}
+
+} // namespace tkd
@@ -0,0 +1,267 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "utils/Types.hpp"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <atomic>
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Work stealing scheduler for the short jobs of a game tick
+///
+/// Unlike ThreadPool, each worker owns a queue: it pops its newest job and,
+/// once empty, steals the oldest job of another worker. A job starts once
+/// all the jobs it depends on are done. The thread waiting on a handle runs
+/// jobs too, so a tick never sleeps while there is work left.
+///
+///////////////////////////////////////////////////////////////////////////////
+class JobSystem
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A task, the jobs it unlocks and its completion state
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Job : public std::enable_shared_from_this<Job>
+    {
+        std::function<void()> task;             //<! The work to run
+        std::shared_ptr<Job> parent;            //<! Job finished after this
+        std::atomic<Uint32> waiting{0};         //<! Dependencies left
+        std::atomic<Uint32> unfinished{1};      //<! Itself and its children
+        std::atomic<bool> done{false};          //<! Is the job finished
+        std::mutex mutex;                       //<! Guards the fields below
+        std::vector<std::shared_ptr<Job>> next; //<! Jobs depending on it
+        std::exception_ptr error;               //<! First exception thrown
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue of a worker, its owner pops the back, thieves the front
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Queue
+    {
+        std::deque<std::shared_ptr<Job>> jobs;  //<! The ready jobs
+        std::mutex mutex;                       //<! The queue mutex
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reference to a submitted job, to wait on or depend on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Handle
+    {
+    private:
+        friend class JobSystem;
+        std::shared_ptr<Job> m_job;             //<! The referenced job
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check if the job and all its children are finished
+        ///
+        /// \return True if done, or if the handle is empty
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        bool isDone(void) const;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Queue>> m_queues;   //<! One queue per worker
+    std::vector<std::thread> m_workers;             //<! The worker threads
+    std::atomic<size_t> m_queued;                   //<! The ready jobs
+    std::atomic<size_t> m_next;                     //<! Queue of next submit
+    std::atomic<size_t> m_waiting;                  //<! Threads in wait
+    std::mutex m_mutex;                             //<! The sleep mutex
+    std::condition_variable m_condition;            //<! The sleep condition
+    std::condition_variable m_finished;             //<! The wait condition
+    bool m_stopping;                                //<! Is the system stopping
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threads The number of workers, 0 to use one per core except
+    /// the one of the calling thread, which helps in wait
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    JobSystem(size_t threads = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Finish the queued jobs and join the workers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~JobSystem();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Worker thread loop
+    ///
+    /// \param index The index of the queue owned by the worker
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void work(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take a ready job, from the own queue first, then by stealing
+    ///
+    /// \param index The queue of the calling worker, or size() if none
+    ///
+    /// \return The job, or nullptr if every queue is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<Job> take(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register a new job on its dependencies, or queue it now
+    ///
+    /// \param job The job to submit
+    /// \param dependencies The jobs to finish before this one starts
+    ///
+    /// \return The handle of the job
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Handle enqueue(
+        std::shared_ptr<Job> job,
+        const std::vector<Handle>& dependencies
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue a job whose dependencies are all done
+    ///
+    /// \param job The job to queue
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void schedule(std::shared_ptr<Job> job);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run a job, then finish it unless children are still running
+    ///
+    /// \param job The job to run
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void execute(const std::shared_ptr<Job>& job);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop one unfinished count, completing the job at zero
+    ///
+    /// A completed job schedules the jobs depending on it and releases its
+    /// parent.
+    ///
+    /// \param job The job to release
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void release(std::shared_ptr<Job> job);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the queue owned by the calling thread
+    ///
+    /// \return The queue index, or size() outside of the workers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t getCurrentQueue(void) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Submit a job
+    ///
+    /// \param task The work to run on any thread of the system
+    /// \param dependencies The jobs to finish before this one starts
+    ///
+    /// \return The handle of the job
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Handle submit(
+        std::function<void()> task,
+        const std::vector<Handle>& dependencies = {}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Submit a job split over ranges of indices
+    ///
+    /// The handle is done once every range is done, so a later job can
+    /// depend on the whole loop.
+    ///
+    /// \param count The number of indices, from 0 to count - 1
+    /// \param grain The minimum number of indices per range
+    /// \param task The work to run on each range [first, last)
+    /// \param dependencies The jobs to finish before the loop starts
+    ///
+    /// \return The handle of the loop
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Handle parallelFor(
+        size_t count,
+        size_t grain,
+        std::function<void(size_t first, size_t last)> task,
+        const std::vector<Handle>& dependencies = {}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run jobs on the calling thread until a job is done
+    ///
+    /// Once no job is left to run, the thread sleeps until the job is done
+    /// or a new job is queued.
+    ///
+    /// \param handle The job to wait for
+    ///
+    /// \throw The first exception thrown by the job or by its children
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void wait(const Handle& handle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return The number of workers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t size(void) const;
+};
+
+} // namespace tkd
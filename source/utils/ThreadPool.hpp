@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2025 TekyoDrift
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace tkd
+///////////////////////////////////////////////////////////////////////////////
+namespace tkd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Fixed size pool of worker threads consuming a shared task queue
+///
+///////////////////////////////////////////////////////////////////////////////
+class ThreadPool
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private properties
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::thread> m_workers;             //<! The worker threads
+    std::queue<std::function<void()>> m_tasks;      //<! The pending tasks
+    std::mutex m_mutex;                             //<! The queue mutex
+    std::condition_variable m_condition;            //<! The queue condition
+    bool m_stopping;                                //<! Is the pool stopping
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threads The number of workers, 0 to use one per core
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool(size_t threads = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Finish the pending tasks and join the workers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Worker thread loop
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void work(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queue a task on the pool
+    ///
+    /// \tparam F The callable type
+    ///
+    /// \param task The task to run on a worker thread
+    ///
+    /// \return A future holding the result, or the exception, of the task
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<F>>
+    {
+        using Result = std::invoke_result_t<F>;
+
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(
+            std::forward<F>(task)
+        );
+        std::future<Result> future = packaged->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace([packaged](void){ (*packaged)(); });
+        }
+        m_condition.notify_one();
+        return (future);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return The number of workers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t size(void) const;
+};
+
+} // namespace tkd